@@ -18,14 +18,19 @@
 #define DBGROUP_BENCHMARK_BENCHMARKER_HPP_
 
 // C++ standard libraries
+#include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <cmath>
 #include <cstddef>
 #include <cstdio>
+#include <fstream>
 #include <future>
 #include <iomanip>
 #include <iostream>
 #include <memory>
+#include <numeric>
+#include <optional>
 #include <random>
 #include <string>
 #include <thread>
@@ -33,11 +38,39 @@
 #include <vector>
 
 // local sources
+#include "dbgroup/benchmark/component/common.hpp"
+#include "dbgroup/benchmark/component/comparison.hpp"
+#include "dbgroup/benchmark/component/environment.hpp"
+#include "dbgroup/benchmark/component/hdr_histogram.hpp"
+#include "dbgroup/benchmark/component/latency_log.hpp"
 #include "dbgroup/benchmark/component/measurements.hpp"
+#include "dbgroup/benchmark/component/metrics.hpp"
+#include "dbgroup/benchmark/component/scalability.hpp"
+#include "dbgroup/benchmark/component/signal_handler.hpp"
+#include "dbgroup/benchmark/component/snapshot.hpp"
+#include "dbgroup/benchmark/component/soak_recorder.hpp"
+#include "dbgroup/benchmark/component/stability.hpp"
+#include "dbgroup/benchmark/component/steady_state.hpp"
+#include "dbgroup/benchmark/component/straggler.hpp"
 #include "dbgroup/benchmark/component/worker.hpp"
 
 namespace dbgroup::benchmark
 {
+/**
+ * @brief A service level objective for percentiled latency.
+ *
+ */
+struct LatencySLO {
+  /// @brief The ID of a target operation.
+  size_t ops_id{};
+
+  /// @brief A target quantile (e.g., 0.99 for 99th percentile latency).
+  double quantile{};
+
+  /// @brief The upper bound of latency [ns].
+  size_t latency{};
+};
+
 /**
  * @brief A class to run benchmark.
  *
@@ -54,6 +87,86 @@ class Benchmarker
 
   using Worker = component::Worker<Target, OperationEngine>;
   using Sketch = component::SimpleDDSketch;
+  using ScalabilityModel = component::ScalabilityModel;
+  using SignalHandler = component::SignalHandler;
+  using SoakRecorder = component::SoakRecorder;
+  using Clock_t = ::std::chrono::high_resolution_clock;
+
+  /*##########################################################################*
+   * Benchmark options
+   *##########################################################################*/
+
+  /**
+   * @brief Options given by a builder.
+   *
+   */
+  struct Options {
+    /// @brief The number of worker threads.
+    size_t thread_num{1};
+
+    /// @brief Targets for calculating parcentile latency.
+    std::vector<double> target_latency{kDefaultLatency};
+
+    /// @brief Seconds to timeout.
+    size_t timeout_in_sec{10};  // NOLINT
+
+    /// @brief A base random seed.
+    size_t rand_seed{std::random_device{}()};
+
+    /// @brief A flat to output measured results as CSV or TXT.
+    bool output_as_csv{false};
+
+    /// @brief A flag to measure throughput (if true) or latency (if false).
+    bool measure_throughput{true};
+
+    /// @brief A flag to report the environment and run pre-flight checks.
+    bool check_env{false};
+
+    /// @brief A flag to abort benchmarks if the machine is noisy.
+    bool abort_if_noisy{false};
+
+    /// @brief The maximum seconds for warming up (zero disables warm-up).
+    size_t max_warmup_in_sec{0};
+
+    /// @brief The path of a raw latency log (an empty string disables logging).
+    std::string latency_log_path{};
+
+    /// @brief The path of an HdrHistogram log (an empty string disables logging).
+    std::string hdr_log_path{};
+
+    /// @brief The number of key buckets (zero disables per-key-bucket measurements).
+    size_t bucket_num{0};
+
+    /// @brief The path of a heatmap (an empty string disables heatmaps).
+    std::string heatmap_path{};
+
+    /// @brief Milliseconds of each time window in heatmaps.
+    size_t heatmap_window_in_ms{100};  // NOLINT
+
+    /// @brief The path of a serialized sketch (an empty string disables saving).
+    std::string sketch_path{};
+
+    /// @brief Milliseconds between progress reports (zero disables reporting).
+    size_t progress_interval_in_ms{0};
+
+    /// @brief Milliseconds of each window for stability (zero disables reports).
+    size_t stability_window_in_ms{0};
+
+    /// @brief A ratio to the median for detecting slow windows.
+    double stability_threshold{kDefaultStabilityThreshold};
+
+    /// @brief The number of sub-operations per logical operation.
+    size_t fan_out{1};
+
+    /// @brief A flag for issuing sub-operations in parallel by helper threads.
+    bool use_fan_out_helpers{false};
+
+    /// @brief The number of straggler workers.
+    size_t straggler_num{0};
+
+    /// @brief A model of periodic stalls of stragglers.
+    component::StallModel stall_model{};
+  };
 
  public:
   /*##########################################################################*
@@ -104,20 +217,24 @@ class Benchmarker
         -> std::unique_ptr<Benchmarker>
     {
       return std::unique_ptr<Benchmarker>{
-          new Benchmarker{target_, target_name_, op_engine_, thread_num_, target_latency_,
-                          timeout_in_sec_, rand_seed_, output_as_csv_, measure_throughput_}};
+          new Benchmarker{target_, target_name_, op_engine_, opts_}};
     }
 
     /**
      * @param thread_num The number of worker threads.
      * @return Oneself.
+     * @note Zero is rejected and the current number of threads is kept.
      */
     constexpr auto
     SetThreadNum(                 //
         const size_t thread_num)  //
         -> Builder &
     {
-      thread_num_ = thread_num;
+      if (thread_num == 0) {
+        std::cerr << "WARNING: the number of worker threads must be positive, so it is ignored.\n";
+        return *this;
+      }
+      opts_.thread_num = thread_num;
       return *this;
     }
 
@@ -130,7 +247,7 @@ class Benchmarker
         std::vector<double> target_latency)  //
         -> Builder &
     {
-      target_latency_ = std::move(target_latency);
+      opts_.target_latency = std::move(target_latency);
       return *this;
     }
 
@@ -143,7 +260,7 @@ class Benchmarker
         const size_t timeout_in_sec)  //
         -> Builder &
     {
-      timeout_in_sec_ = timeout_in_sec;
+      opts_.timeout_in_sec = timeout_in_sec;
       return *this;
     }
 
@@ -156,7 +273,7 @@ class Benchmarker
         const size_t rand_seed)  //
         -> Builder &
     {
-      rand_seed_ = rand_seed;
+      opts_.rand_seed = rand_seed;
       return *this;
     }
 
@@ -169,8 +286,226 @@ class Benchmarker
         const bool measure_throughput)  //
         -> Builder &
     {
-      output_as_csv_ = true;
-      measure_throughput_ = measure_throughput;
+      opts_.output_as_csv = true;
+      opts_.measure_throughput = measure_throughput;
+      return *this;
+    }
+
+    /**
+     * @brief Report the benchmarking environment and run pre-flight checks.
+     *
+     * @param abort_if_noisy A flag for aborting benchmarks (true) or only
+     * warning (false) if the machine is noisy.
+     * @return Oneself.
+     */
+    constexpr auto
+    CheckEnvironment(               //
+        const bool abort_if_noisy)  //
+        -> Builder &
+    {
+      opts_.check_env = true;
+      opts_.abort_if_noisy = abort_if_noisy;
+      return *this;
+    }
+
+    /**
+     * @brief Detect the end of the initial transient and start measuring then.
+     *
+     * @param max_warmup_in_sec The maximum seconds for warming up.
+     * @return Oneself.
+     * @note Throughput is sampled every 50 ms and detection requires at least
+     * 40 samples, so warming up takes two seconds or more.
+     */
+    constexpr auto
+    DetectWarmUp(                        //
+        const size_t max_warmup_in_sec)  //
+        -> Builder &
+    {
+      opts_.max_warmup_in_sec = max_warmup_in_sec;
+      return *this;
+    }
+
+    /**
+     * @brief Stream every latency sample to a binary file.
+     *
+     * @param latency_log_path The path of an output log file.
+     * @return Oneself.
+     * @see component::LatencyLog for the file format.
+     */
+    constexpr auto
+    SetLatencyLog(                       //
+        std::string latency_log_path)  //
+        -> Builder &
+    {
+      opts_.latency_log_path = std::move(latency_log_path);
+      return *this;
+    }
+
+    /**
+     * @brief Export measured latency as HdrHistogram interval logs.
+     *
+     * `Run` writes a merged histogram for each operation, and `RunSoakTest`
+     * writes histograms for each window.
+     *
+     * @param hdr_log_path The path of an output log file.
+     * @return Oneself.
+     */
+    constexpr auto
+    SetHdrHistogramLog(            //
+        std::string hdr_log_path)  //
+        -> Builder &
+    {
+      opts_.hdr_log_path = std::move(hdr_log_path);
+      return *this;
+    }
+
+    /**
+     * @brief Measure throughput and latency for each key bucket.
+     *
+     * An operation engine must provide `GetKeyBucket(arg)` to classify
+     * operation arguments into buckets (e.g., key ranges or page IDs).
+     *
+     * @param bucket_num The number of key buckets.
+     * @return Oneself.
+     */
+    constexpr auto
+    MeasureByKeyBucket(           //
+        const size_t bucket_num)  //
+        -> Builder &
+    {
+      opts_.bucket_num = bucket_num;
+      return *this;
+    }
+
+    /**
+     * @brief Write latency-over-time heatmaps for each operation type.
+     *
+     * `Run` rolls workers' sketches every given window to build heatmaps,
+     * whereas `RunSoakTest` uses its own windows instead.
+     *
+     * @param heatmap_path The path of an output file.
+     * @param window_in_ms Milliseconds of each time window.
+     * @return Oneself.
+     * @see component::HeatmapWriter for the file format.
+     */
+    constexpr auto
+    SetHeatmapLog(  //
+        std::string heatmap_path,
+        const size_t window_in_ms)  //
+        -> Builder &
+    {
+      opts_.heatmap_path = std::move(heatmap_path);
+      opts_.heatmap_window_in_ms = window_in_ms;
+      return *this;
+    }
+
+    /**
+     * @brief Save merged latency sketches for comparing with other runs.
+     *
+     * @param sketch_path The path of an output file.
+     * @return Oneself.
+     * @see component::DistributionComparison::ReportFiles for comparison.
+     */
+    constexpr auto
+    SetSketchOutput(  //
+        std::string sketch_path)  //
+        -> Builder &
+    {
+      opts_.sketch_path = std::move(sketch_path);
+      return *this;
+    }
+
+    /**
+     * @brief Output live throughput and latency while workers are running.
+     *
+     * The benchmarker takes snapshots of workers' sketches without stopping
+     * them. Progress is not reported in rolling-window modes (i.e., with
+     * heatmaps and in soak tests) because they output their own windows.
+     *
+     * @param interval_in_ms Milliseconds between progress reports (zero
+     * disables reporting).
+     * @return Oneself.
+     */
+    constexpr auto
+    ReportProgress(  //
+        const size_t interval_in_ms)  //
+        -> Builder &
+    {
+      opts_.progress_interval_in_ms = interval_in_ms;
+      return *this;
+    }
+
+    /**
+     * @brief Report the stability of throughput over fixed-size windows.
+     *
+     * `Run` rolls workers' sketches every given window and outputs the
+     * coefficient of variation, the slowest and fastest windows, and the
+     * fraction of windows below a given ratio of the median. If heatmaps are
+     * also enabled, their windows are used instead. `RunSoakTest` always
+     * reports stability over its own windows.
+     *
+     * @param window_in_ms Milliseconds of each window (zero disables reports
+     * in `Run`).
+     * @param threshold A ratio to the median for detecting slow windows.
+     * @return Oneself.
+     */
+    constexpr auto
+    MeasureStability(  //
+        const size_t window_in_ms,
+        const double threshold = kDefaultStabilityThreshold)  //
+        -> Builder &
+    {
+      opts_.stability_window_in_ms = window_in_ms;
+      opts_.stability_threshold = threshold;
+      return *this;
+    }
+
+    /**
+     * @brief Group consecutive operations into logical fan-out operations.
+     *
+     * Each logical operation issues `fan_out` sub-operations (e.g., requests to
+     * shards) and its latency is the maximum of them. In addition to the usual
+     * results for logical operations, the benchmarker reports sub-operation
+     * latency and tail amplification. Throughput is counted in logical
+     * operations.
+     *
+     * @param fan_out The number of sub-operations per logical operation (zero
+     * or one disables fan-out).
+     * @param use_helpers A flag for issuing sub-operations in parallel by
+     * `fan_out - 1` helper threads per worker (true) or serially (false).
+     * @return Oneself.
+     */
+    constexpr auto
+    SetFanOut(  //
+        const size_t fan_out,
+        const bool use_helpers = false)  //
+        -> Builder &
+    {
+      opts_.fan_out = fan_out;
+      opts_.use_fan_out_helpers = use_helpers;
+      return *this;
+    }
+
+    /**
+     * @brief Designate workers as stragglers that stall periodically.
+     *
+     * Workers with the smallest IDs become stragglers. The benchmarker reports
+     * latency of the other workers and stragglers separately to show the
+     * impact of stalls. To stall inside critical sections, targets must call
+     * `component::Straggler::StallPoint` there.
+     *
+     * @param straggler_num The number of straggler workers.
+     * @param model A model of periodic stalls.
+     * @return Oneself.
+     */
+    constexpr auto
+    SetStragglers(  //
+        const size_t straggler_num,
+        const component::StallModel &model)  //
+        -> Builder &
+    {
+      opts_.straggler_num = straggler_num;
+      opts_.stall_model = model;
       return *this;
     }
 
@@ -188,23 +523,8 @@ class Benchmarker
     /// @brief An target operation generator.
     OperationEngine &op_engine_{};
 
-    /// @brief The number of worker threads.
-    size_t thread_num_{1};
-
-    /// @brief Targets for calculating parcentile latency.
-    std::vector<double> target_latency_{kDefaultLatency};
-
-    /// @brief Seconds to timeout.
-    size_t timeout_in_sec_{10};  // NOLINT
-
-    /// @brief A base random seed.
-    size_t rand_seed_{std::random_device{}()};
-
-    /// @brief A flat to output measured results as CSV or TXT.
-    bool output_as_csv_{false};
-
-    /// @brief A flag to measure throughput (if true) or latency (if false).
-    bool measure_throughput_{true};
+    /// @brief Benchmark options.
+    Options opts_{};
   };
 
   /*##########################################################################*
@@ -230,163 +550,986 @@ class Benchmarker
   /**
    * @brief Run benchmark and output results to stdout.
    *
+   * If SIGINT or SIGTERM is received during benchmarking, workers finish their
+   * current operations and this function outputs partial results.
    */
   void
   Run()
   {
     Log("*** START " + target_name_ + " ***");
-    /*------------------------------------------------------------------------*
-     * Preparation of benchmark workers
-     *------------------------------------------------------------------------*/
-    Log("...Prepare workers for benchmarking.");
-    is_running_.store(true, kRelaxed);
-    ready_for_benchmarking_.store(false, kRelaxed);
-    worker_cnt_.store(0, kRelaxed);
-
-    std::vector<std::future<Sketch>> result_futures{};
-
-    // create workers in each thread
-    std::mt19937_64 rand{rand_seed_};
-    for (size_t i = 0; i < thread_num_; ++i) {
-      std::promise<Sketch> res_p{};
-      result_futures.emplace_back(res_p.get_future());
-      std::thread{&Benchmarker::RunWorker, this, std::move(res_p), i, rand()}.detach();
+    if (!RunPreFlightChecks(thread_num_)) return;
+    const SignalHandler handler{};
+    const auto has_heatmap = !heatmap_path_.empty();
+    const auto has_stability = stability_window_.count() > 0;
+    const auto &result = (has_heatmap || has_stability)
+                             ? RunRollingWindows(has_heatmap ? heatmap_window_ : stability_window_,
+                                                 "", nullptr)
+                             : RunWorkers(thread_num_, 0);
+
+    LogInterruption();
+    LogWarmUp(result);
+    LogWindows(result);
+    LogLifecycle(result, false);
+    LogThroughput(result);
+    if (has_stability) {
+      LogStability(*recorder_);
     }
-    while (worker_cnt_.load(kRelaxed) < thread_num_) {
-      // wait for all workers to be created
+    recorder_.reset();
+    LogLatency(result.sketch);
+    LogFanOut(result);
+    LogStragglers(result);
+    LogMetrics(result);
+    LogKeyBuckets(result);
+    if (!hdr_log_path_.empty()) {
+      const auto max_window = *std::max_element(result.windows.begin(), result.windows.end());
+      component::HdrLogWriter{hdr_log_path_}.Write(result.sketch, 0.0,
+                                                   static_cast<double>(max_window) / 1E9);
     }
-
-    /*------------------------------------------------------------------------*
-     * Measuring throughput/latency
-     *------------------------------------------------------------------------*/
-    std::vector<Sketch> results{};
-    results.reserve(thread_num_);
-
-    Log("...Run workers.");
-    ready_for_benchmarking_.store(true, kRelaxed);
-    const auto &wake_up = std::chrono::high_resolution_clock::now() + timeout_in_sec_;
-
-    for (auto &&future : result_futures) {
-      const auto status = future.wait_until(wake_up);
-      if (status != std::future_status::ready && is_running_.load(kRelaxed)) {
-        Log("...Interrupting workers.");
-        is_running_.store(false, kRelaxed);
+    if (!sketch_path_.empty()) {
+      std::ofstream ofs{sketch_path_, std::ios::binary};
+      result.sketch.Serialize(ofs);
+      if (!ofs) {
+        std::cerr << "WARNING: failed to write a sketch to " << sketch_path_ << "\n";
       }
-      results.emplace_back(future.get());
-    }
-
-    /*------------------------------------------------------------------------*
-     * Output benchmarkings results
-     *------------------------------------------------------------------------*/
-    Log("...Finish running.");
-
-    auto &&sketch = results[0];
-    for (size_t i = 1; i < thread_num_; ++i) {
-      sketch += results[i];
     }
-
-    LogThroughput(sketch);
-    LogLatency(sketch);
+    sketch_ = result.sketch;
     Log("*** FINISH ***\n");
+    std::cout << std::flush;
   }
 
- private:
-  /*##########################################################################*
-   * Internal constants
-   *##########################################################################*/
-
-  /// @brief The alias of `std::memory_order_relaxed`.
-  static constexpr auto kRelaxed = std::memory_order_relaxed;
-
-  /// @brief Targets for calculating parcentile latency.
-  static constexpr auto kDefaultLatency  //
-      = {0.0, 0.25, 0.50, 0.75, 0.90, 0.95, 0.99, 0.999, 0.9999, 1.0};
-
-  /*##########################################################################*
-   * Internal constructors
-   *##########################################################################*/
-
   /**
-   * @brief Construct a new Benchmarker object.
+   * @brief Get merged latency of the last `Run`.
    *
-   * @param target A reference to an actual target implementation.
-   * @param target_name The name of a benchmarking target.
-   * @param op_engine A reference to a operation generator.
-   * @param thread_num The number of worker threads.
-   * @param target_latency A set of percentiles for measuring latency.
-   * @param timeout_in_sec Seconds to timeout.
-   * @param rand_seed A base random seed.
-   * @param output_as_csv A flag to output benchmarking results as CSV or TEXT.
-   * @param measure_throughput A flag for measuring throughput (true) or latency (false).
+   * The returned sketch can be compared with that of another benchmarker by
+   * `component::DistributionComparison`.
+   *
+   * @return Merged latency sketches.
    */
-  Benchmarker(  //
-      Target &target,
-      std::string target_name,
-      OperationEngine &op_engine,
-      const size_t thread_num,
-      std::vector<double> target_latency,
-      const size_t timeout_in_sec,
-      const size_t rand_seed,
-      const bool output_as_csv,
-      const bool measure_throughput)
-      : target_{target},
-        target_name_{std::move(target_name)},
-        op_engine_{op_engine},
-        thread_num_{thread_num},
-        target_latency_{std::move(target_latency)},
-        rand_seed_{rand_seed},
-        timeout_in_sec_{timeout_in_sec},
-        output_as_csv_{output_as_csv},
-        measure_throughput_{measure_throughput}
+  [[nodiscard]] constexpr auto
+  GetLatencySketch() const  //
+      -> const Sketch &
   {
+    return sketch_;
   }
 
-  /*##########################################################################*
-   * Internal utility functions
-   *##########################################################################*/
-
   /**
-   * @brief Run a worker thread to measure throughput or latency.
+   * @brief Search the maximum throughput that satisfies given latency SLOs.
    *
-   * @param result_p A promise of a worker pointer that holds benchmarking results.
-   * @param thread_id A unique thread ID.
-   * @param rand_seed A random seed.
+   * This function first measures closed-loop throughput as the upper bound of
+   * arrival rates. Then, it performs a bisection over open-loop arrival rates
+   * using the same target and outputs the latency of all the probed rates.
+   *
+   * @param slos Latency SLOs to be satisfied.
+   * @param search_num The number of probes for the bisection.
+   * @note A probe that records no latency of an SLO's operation is regarded
+   * as violating the SLO. The search is aborted if an SLO has an invalid
+   * operation ID or the closed-loop run completes no operations.
    */
   void
-  RunWorker(  //
-      std::promise<Sketch> result_p,
-      const size_t thread_id,
-      const size_t rand_seed)
+  SearchMaxThroughput(  //
+      const std::vector<LatencySLO> &slos,
+      const size_t search_num = kDefaultSearchNum)
   {
-    Worker worker{target_, op_engine_, is_running_, thread_id, rand_seed};
-    worker_cnt_.fetch_add(1, kRelaxed);
-    while (!ready_for_benchmarking_.load(kRelaxed)) {
-      // the preparation has finished, so wait other workers
+    Log("*** START SLO SEARCH " + target_name_ + " ***");
+    for (const auto &slo : slos) {
+      if (slo.ops_id >= OperationEngine::OPType::kTotalNum) {
+        std::cerr << "ERROR: an SLO has an invalid operation ID " << slo.ops_id
+                  << ", so the SLO search is aborted.\n";
+        Log("*** ABORTED ***\n");
+        return;
+      }
+    }
+    if (!RunPreFlightChecks(thread_num_)) return;
+    const SignalHandler handler{};
+    const auto &max_result = RunWorkers(thread_num_, 0);
+
+    std::vector<Probe> probes{};
+    probes.reserve(search_num);
+    auto lo = 0.0;
+    auto hi = ComputeThroughput(max_result, false);
+    auto best = 0.0;
+    if (SignalHandler::IsInterrupted() || hi <= 0) {
+      std::cerr << "ERROR: the closed-loop run was interrupted or completed no operations, "
+                   "so the SLO search is aborted.\n";
+      Log("*** ABORTED ***\n");
+      return;
+    }
+    for (size_t i = 0; i < search_num && !SignalHandler::IsInterrupted(); ++i) {
+      const auto rate = (lo + hi) / 2;
+      const auto interval = static_cast<size_t>(static_cast<double>(thread_num_) * 1E9 / rate);
+      Log("...Probe " + std::to_string(static_cast<size_t>(rate)) + " [OPS/s].");
+      auto &&result = RunWorkers(thread_num_, interval);
+      const auto &sketch = result.sketch;
+
+      auto satisfied = true;
+      for (const auto &slo : slos) {
+        if (!sketch.HasLatency(slo.ops_id)) {
+          std::cerr << "WARNING: the probe recorded no latency of operation " << slo.ops_id
+                    << ", so its SLO is regarded as violated.\n";
+          satisfied = false;
+          break;
+        }
+        if (sketch.Quantile(slo.ops_id, slo.quantile) > slo.latency) {
+          satisfied = false;
+          break;
+        }
+      }
+      if (!SignalHandler::IsInterrupted()) {  // partial results are not used for search
+        if (satisfied) {
+          best = rate;
+          lo = rate;
+        } else {
+          hi = rate;
+        }
+      }
+
+      const auto throughput = ComputeThroughput(result, true);
+      probes.emplace_back(Probe{rate, throughput, satisfied, std::move(result.sketch)});
     }
 
-    worker.Measure();
-    result_p.set_value(worker.MoveSketch());
+    LogInterruption();
+    LogProbes(probes);
+    if (output_as_csv_) {
+      std::cout << best << "\n";
+    } else {
+      std::cout << "Max Throughput within SLOs [OPS/s]: " << best << "\n";
+    }
+    Log("*** FINISH ***\n");
+    std::cout << std::flush;
   }
 
   /**
-   * @brief Compute a throughput score and output it to stdout.
+   * @brief Measure throughput with various numbers of threads and fit
+   * scalability models to them.
    *
-   * @param results benchmarking results.
+   * This function outputs the contention and coherency coefficients of
+   * Amdahl's law and the Universal Scalability Law (USL) and predicts
+   * throughput with the given numbers of threads.
+   *
+   * @param thread_nums The numbers of worker threads to be measured.
+   * @param predicted_nums The numbers of worker threads to be predicted.
+   * @note Zeros in the given numbers are rejected and skipped.
    */
   void
-  LogThroughput(  //
-      const Sketch &sketch) const
+  RunScalabilityTest(  //
+      const std::vector<size_t> &thread_nums,
+      const std::vector<size_t> &predicted_nums = {})
   {
-    if (output_as_csv_ && !measure_throughput_) return;
-
-    const size_t exec_num = sketch.GetTotalExecNum();
-    const size_t avg_nano_time = sketch.GetTotalExecTime() / thread_num_;
-    const double throughput = static_cast<double>(exec_num) / (avg_nano_time / 1E9);
+    Log("*** START SCALABILITY TEST " + target_name_ + " ***");
+    if (std::find(thread_nums.begin(), thread_nums.end(), 0) != thread_nums.end()
+        || std::find(predicted_nums.begin(), predicted_nums.end(), 0) != predicted_nums.end()) {
+      std::cerr << "WARNING: the number of worker threads must be positive, "
+                   "so zeros are skipped.\n";
+    }
+    const auto max_it = std::max_element(thread_nums.begin(), thread_nums.end());
+    if (!RunPreFlightChecks(max_it == thread_nums.end() ? 0 : *max_it)) return;
+    const SignalHandler handler{};
+    std::vector<size_t> measured_nums{};
+    std::vector<double> throughputs{};
+    throughputs.reserve(thread_nums.size());
+    for (const auto thread_num : thread_nums) {
+      if (SignalHandler::IsInterrupted()) break;
+      if (thread_num == 0) continue;
+      Log("...Measure with " + std::to_string(thread_num) + " threads.");
+      const auto &result = RunWorkers(thread_num, 0);
+      measured_nums.emplace_back(thread_num);
+      throughputs.emplace_back(ComputeThroughput(result, false));
+    }
 
+    LogInterruption();
+    const ScalabilityModel amdahl{ScalabilityModel::kAmdahl, measured_nums, throughputs};
+    const ScalabilityModel usl{ScalabilityModel::kUSL, measured_nums, throughputs};
     if (output_as_csv_) {
-      std::cout << throughput << "\n";
+      std::cout << "model,lambda,contention,coherency\n"
+                << "amdahl," << amdahl.GetLambda() << "," << amdahl.GetContention() << ","
+                << amdahl.GetCoherency() << "\n"
+                << "usl," << usl.GetLambda() << "," << usl.GetContention() << ","
+                << usl.GetCoherency() << "\n"
+                << "threads,measured,amdahl,usl\n";
     } else {
-      std::cout << "Throughput [OPS/s]: " << throughput << "\n";
+      std::printf("Amdahl: lambda %12.1f, contention %.6f\n",  // NOLINT
+                  amdahl.GetLambda(), amdahl.GetContention());
+      std::printf(  // NOLINT
+          "USL:    lambda %12.1f, contention %.6f, coherency %.6f, peak threads %lu\n",
+          usl.GetLambda(), usl.GetContention(), usl.GetCoherency(), usl.GetPeakThreadNum());
+      Log("Throughput [OPS/s] (threads: measured, Amdahl, USL):");
+    }
+
+    const auto &log_row = [&](const size_t thread_num, const double *measured) {
+      if (output_as_csv_) {
+        std::cout << thread_num << ",";
+        if (measured != nullptr) std::cout << *measured;
+        std::cout << "," << amdahl.Predict(thread_num) << "," << usl.Predict(thread_num) << "\n";
+      } else if (measured != nullptr) {
+        std::printf("  %4lu: %12.1f, %12.1f, %12.1f\n",  // NOLINT
+                    thread_num, *measured, amdahl.Predict(thread_num), usl.Predict(thread_num));
+      } else {
+        std::printf("  %4lu: %12s, %12.1f, %12.1f\n",  // NOLINT
+                    thread_num, "-", amdahl.Predict(thread_num), usl.Predict(thread_num));
+      }
+    };
+    for (size_t i = 0; i < measured_nums.size(); ++i) {
+      log_row(measured_nums[i], &throughputs[i]);
+    }
+    for (const auto thread_num : predicted_nums) {
+      if (thread_num == 0) continue;
+      log_row(thread_num, nullptr);
+    }
+    Log("*** FINISH ***\n");
+    std::cout << std::flush;
+  }
+
+  /**
+   * @brief Run a long-running benchmark with rolling windows.
+   *
+   * Workers hand over their sketches at the end of every window, and a
+   * background thread appends per-window throughput, latency, and RSS to a
+   * log file. In addition to the usual results, this function outputs the
+   * drift of them over the whole run. The length of the run is given by
+   * `SetTimeOut`, and memory usage does not depend on it.
+   *
+   * @param window_in_sec Seconds of each window.
+   * @param log_path The path of an output log file (an empty string disables
+   * logging).
+   */
+  void
+  RunSoakTest(  //
+      const size_t window_in_sec,
+      const std::string &log_path = "")
+  {
+    Log("*** START SOAK TEST " + target_name_ + " ***");
+    if (!RunPreFlightChecks(thread_num_)) return;
+    const SignalHandler handler{};
+    const std::chrono::nanoseconds window{std::chrono::seconds{std::max(window_in_sec, 1UL)}};
+    std::unique_ptr<component::HdrLogWriter> hdr_log{};
+    if (!hdr_log_path_.empty()) {
+      hdr_log = std::make_unique<component::HdrLogWriter>(hdr_log_path_);
+    }
+    const auto &result = RunRollingWindows(window, log_path, hdr_log.get());
+
+    LogInterruption();
+    LogWarmUp(result);
+    LogWindows(result);
+    LogLifecycle(result, false);
+    LogThroughput(result);
+    LogStability(*recorder_);
+    LogLatency(result.sketch);
+    LogFanOut(result);
+    LogStragglers(result);
+    LogMetrics(result);
+    LogDrift(*recorder_);
+    recorder_.reset();
+    Log("*** FINISH ***\n");
+    std::cout << std::flush;
+  }
+
+  /**
+   * @brief Run a benchmark while creating and destroying workers continuously.
+   *
+   * Each worker thread repeatedly constructs a worker, measures operations
+   * during a given lifetime, and destroys it, so `Target::SetUpForWorker` and
+   * `Target::TearDownForWorker` are called throughout the run. This function
+   * outputs the distribution of their execution time and throughput including
+   * the cost of thread churn (i.e., per wall-clock time). The length of the run
+   * is given by `SetTimeOut`.
+   *
+   * @param lifetime_in_us Microseconds of each worker's lifetime.
+   */
+  void
+  RunChurnTest(  //
+      const size_t lifetime_in_us)
+  {
+    Log("*** START CHURN TEST " + target_name_ + " ***");
+    if (!RunPreFlightChecks(thread_num_)) return;
+    if (!heatmap_path_.empty() || stability_window_.count() > 0 || !hdr_log_path_.empty()) {
+      std::cerr << "WARNING: heatmaps, stability, and HdrHistogram logs are not supported in "
+                << "churn tests, so they are ignored.\n";
+    }
+    const SignalHandler handler{};
+    const std::chrono::microseconds lifetime{std::max(lifetime_in_us, 1UL)};
+    const auto &result = RunWorkers(thread_num_, 0, std::chrono::nanoseconds{lifetime}.count());
+
+    LogInterruption();
+    LogWarmUp(result);
+    LogWindows(result);
+    const auto throughput = ComputeThroughput(result, true);
+    if (!output_as_csv_) {
+      const auto avg_sec = static_cast<double>(std::accumulate(
+                               result.windows.begin(), result.windows.end(), 0UL))
+                           / static_cast<double>(result.windows.size()) / 1E9;
+      const auto worker_num = result.lifecycle.GetExecNum(kSetUpID);
+      std::cout << "Throughput [OPS/s]: " << throughput << "\n"
+                << "Worker Generations: " << worker_num << " ("
+                << static_cast<double>(worker_num) / avg_sec << " workers/s)\n";
+    } else if (measure_throughput_) {
+      std::cout << throughput << "\n";
+    }
+    LogLifecycle(result, true);
+    LogLatency(result.sketch);
+    LogMetrics(result);
+    Log("*** FINISH ***\n");
+    std::cout << std::flush;
+  }
+
+ private:
+  /*##########################################################################*
+   * Internal constants
+   *##########################################################################*/
+
+  /// @brief The alias of `std::memory_order_relaxed`.
+  static constexpr auto kRelaxed = std::memory_order_relaxed;
+
+  /// @brief Targets for calculating parcentile latency.
+  static constexpr auto kDefaultLatency  //
+      = {0.0, 0.25, 0.50, 0.75, 0.90, 0.95, 0.99, 0.999, 0.9999, 1.0};
+
+  /// @brief The ID of setup hooks in lifecycle sketches.
+  static constexpr size_t kSetUpID = 0;
+
+  /// @brief The ID of teardown hooks in lifecycle sketches.
+  static constexpr size_t kTearDownID = 1;
+
+  /// @brief The number of hooks in lifecycle sketches.
+  static constexpr size_t kLifecycleNum = 2;
+
+  /// @brief The default ratio to the median for detecting slow windows.
+  static constexpr double kDefaultStabilityThreshold = 0.9;
+
+  /// @brief The default number of probes for searching the maximum throughput.
+  static constexpr size_t kDefaultSearchNum = 8;
+
+  /// @brief An interval for checking interruption.
+  static constexpr auto kPollInterval = std::chrono::milliseconds{10};
+
+  /// @brief A delay for all the workers to start measuring simultaneously.
+  static constexpr auto kStartDelay = std::chrono::milliseconds{1};
+
+  /// @brief An interval for monitoring throughput during warm-up.
+  static constexpr auto kWarmUpInterval = std::chrono::milliseconds{50};
+
+  /*##########################################################################*
+   * Internal types
+   *##########################################################################*/
+
+  /**
+   * @brief Measurement results of workers.
+   *
+   */
+  struct Result {
+    /// @brief Measured latency.
+    Sketch sketch{OperationEngine::OPType::kTotalNum};
+
+    /// @brief Measured wall-clock windows of each worker [ns].
+    std::vector<size_t> windows{};
+
+    /// @brief Elapsed time for warming up [ns].
+    size_t warmup_elapsed{};
+
+    /// @brief The detected length of the initial transient [ns].
+    std::optional<size_t> warmup{};
+
+    /// @brief Measured latency for each key bucket.
+    std::vector<Sketch> buckets{};
+
+    /// @brief Measured latency of fan-out sub-operations.
+    Sketch sub_ops{OperationEngine::OPType::kTotalNum};
+
+    /// @brief Measured latency of non-straggler workers.
+    Sketch others{OperationEngine::OPType::kTotalNum};
+
+    /// @brief Measured latency of straggler workers.
+    Sketch stragglers{OperationEngine::OPType::kTotalNum};
+
+    /// @brief The number of stalls triggered by stragglers.
+    size_t stall_num{};
+
+    /// @brief Target-defined metrics.
+    component::MetricsRegistry metrics{};
+
+    /// @brief Execution time of setup and teardown hooks of each worker.
+    Sketch lifecycle{kLifecycleNum};
+  };
+
+  /**
+   * @brief A measurement result at a probed arrival rate.
+   *
+   */
+  struct Probe {
+    /// @brief A probed arrival rate [OPS/s].
+    double rate{};
+
+    /// @brief Achieved throughput [OPS/s].
+    double throughput{};
+
+    /// @brief A flag for indicating all the SLOs are satisfied.
+    bool satisfied{};
+
+    /// @brief Measured latency.
+    Sketch sketch{};
+  };
+
+  /*##########################################################################*
+   * Internal constructors
+   *##########################################################################*/
+
+  /**
+   * @brief Construct a new Benchmarker object.
+   *
+   * @param target A reference to an actual target implementation.
+   * @param target_name The name of a benchmarking target.
+   * @param op_engine A reference to a operation generator.
+   * @param opts Options given by a builder.
+   */
+  Benchmarker(  //
+      Target &target,
+      std::string target_name,
+      OperationEngine &op_engine,
+      Options opts)
+      : target_{target},
+        target_name_{std::move(target_name)},
+        op_engine_{op_engine},
+        thread_num_{opts.thread_num},
+        target_latency_{std::move(opts.target_latency)},
+        rand_seed_{opts.rand_seed},
+        timeout_in_sec_{opts.timeout_in_sec},
+        max_warmup_{opts.max_warmup_in_sec},
+        output_as_csv_{opts.output_as_csv},
+        measure_throughput_{opts.measure_throughput},
+        check_env_{opts.check_env},
+        abort_if_noisy_{opts.abort_if_noisy},
+        hdr_log_path_{std::move(opts.hdr_log_path)},
+        bucket_num_{component::HasKeyBucket<OperationEngine> ? opts.bucket_num : 0},
+        heatmap_path_{std::move(opts.heatmap_path)},
+        heatmap_window_{std::max(opts.heatmap_window_in_ms, 1UL)},
+        sketch_path_{std::move(opts.sketch_path)},
+        progress_interval_{opts.progress_interval_in_ms},
+        stability_window_{opts.stability_window_in_ms},
+        stability_threshold_{opts.stability_threshold},
+        fan_out_{std::max(opts.fan_out, 1UL)},
+        use_fan_out_helpers_{opts.use_fan_out_helpers},
+        straggler_num_{(opts.stall_model.period_nano > 0) ? opts.straggler_num : 0},
+        stall_model_{opts.stall_model}
+  {
+    if (opts.bucket_num > 0 && bucket_num_ == 0) {
+      std::cerr << "WARNING: the operation engine does not provide `GetKeyBucket`, "
+                << "so per-key-bucket measurements are disabled.\n";
+    }
+    if (progress_interval_.count() > 0) {
+      snapshots_ = std::make_unique<component::SnapshotCollector>();
+    }
+    if (!opts.latency_log_path.empty()) {
+      latency_log_ = std::make_unique<component::LatencyLog>(opts.latency_log_path);
+      if (!latency_log_->IsOpen()) {
+        latency_log_.reset();
+      }
+    }
+  }
+
+  /*##########################################################################*
+   * Internal utility functions
+   *##########################################################################*/
+
+  /**
+   * @brief Report the benchmarking environment and run pre-flight checks.
+   *
+   * @param thread_num The number of worker threads.
+   * @retval true if benchmarking can be continued.
+   * @retval false if the machine is noisy and benchmarking should be aborted.
+   */
+  [[nodiscard]] auto
+  RunPreFlightChecks(  //
+      const size_t thread_num) const  //
+      -> bool
+  {
+    if (!check_env_) return true;
+
+    Log("...Run pre-flight checks.");
+    component::Environment env{component::GetCompilerInfo()};
+    env.CheckNoise(thread_num);
+    if (!output_as_csv_) {
+      env.Report(std::cout);
+    }
+    for (const auto &warning : env.GetWarnings()) {
+      std::cerr << "WARNING: " << warning << "\n";
+    }
+    if (abort_if_noisy_ && env.IsNoisy()) {
+      std::cerr << "ERROR: the machine is noisy, so benchmarking is aborted.\n";
+      Log("*** ABORTED ***\n");
+      return false;
+    }
+    return true;
+  }
+
+  /**
+   * @brief Run worker threads and gather their results.
+   *
+   * All the workers start at the same timestamp and stop themselves at the
+   * common deadline, so they measure the same wall-clock interval.
+   *
+   * @param thread_num The number of worker threads.
+   * @param interval_nano An interval between operation arrivals for each worker
+   * [ns] (zero means a closed-loop benchmark).
+   * @param lifetime_nano The lifetime of each worker [ns] (zero means workers
+   * live until the deadline).
+   * @return Merged measurement results.
+   */
+  auto
+  RunWorkers(  //
+      const size_t thread_num,
+      const size_t interval_nano,
+      const size_t lifetime_nano = 0)  //
+      -> Result
+  {
+    /*------------------------------------------------------------------------*
+     * Preparation of benchmark workers
+     *------------------------------------------------------------------------*/
+    Log("...Prepare workers for benchmarking.");
+    is_running_.store(true, kRelaxed);
+    is_warming_up_.store(max_warmup_.count() > 0, kRelaxed);
+    ready_for_benchmarking_.store(false, kRelaxed);
+    worker_cnt_.store(0, kRelaxed);
+    exec_counters_ = std::make_unique<component::PaddedCounter[]>(thread_num);
+    if (latency_log_) {
+      latency_log_->Start(thread_num);
+    }
+    const auto report_progress = snapshots_ && !recorder_;
+    if (report_progress) {
+      snapshots_->Start(thread_num, OperationEngine::OPType::kTotalNum);
+    }
+
+    std::vector<std::future<Result>> result_futures{};
+
+    // create workers in each thread
+    std::mt19937_64 rand{rand_seed_};
+    for (size_t i = 0; i < thread_num; ++i) {
+      std::promise<Result> res_p{};
+      result_futures.emplace_back(res_p.get_future());
+      std::thread{&Benchmarker::RunWorker, this, std::move(res_p), i, rand(), interval_nano,
+                  lifetime_nano}
+          .detach();
+    }
+    while (worker_cnt_.load(kRelaxed) < thread_num) {
+      // wait for all workers to be created
+    }
+
+    /*------------------------------------------------------------------------*
+     * Measuring throughput/latency
+     *------------------------------------------------------------------------*/
+    Result result{};
+    if (max_warmup_.count() > 0) {
+      Log("...Warm up workers.");
+      const auto &begin = Clock_t::now();
+      ready_for_benchmarking_.store(true, std::memory_order_release);
+      result.warmup = MonitorWarmUp(thread_num);
+      result.warmup_elapsed = std::chrono::nanoseconds{Clock_t::now() - begin}.count();
+    }
+
+    Log("...Run workers.");
+    start_time_ = Clock_t::now() + kStartDelay;
+    deadline_ = start_time_ + timeout_in_sec_;
+    if (max_warmup_.count() > 0) {
+      is_warming_up_.store(false, std::memory_order_release);
+    } else {
+      ready_for_benchmarking_.store(true, std::memory_order_release);
+    }
+
+    auto next_report = start_time_ + progress_interval_;
+    size_t reported_num = 0;
+    for (auto &&future : result_futures) {
+      while (future.wait_for(kPollInterval) != std::future_status::ready) {
+        if (is_running_.load(kRelaxed) && SignalHandler::IsInterrupted()) {
+          Log("...Interrupted by a signal.");
+          is_running_.store(false, kRelaxed);
+        }
+        if (report_progress && Clock_t::now() >= next_report) {
+          reported_num = LogProgress(snapshots_->Collect(), reported_num);
+          next_report += progress_interval_;
+        }
+      }
+      auto &&worker_res = future.get();
+      result.sketch += worker_res.sketch;
+      result.sub_ops += worker_res.sub_ops;
+      result.others += worker_res.others;
+      result.stragglers += worker_res.stragglers;
+      result.stall_num += worker_res.stall_num;
+      result.metrics += worker_res.metrics;
+      result.lifecycle += worker_res.lifecycle;
+      result.windows.emplace_back(worker_res.windows.front());
+      if (result.buckets.empty()) {
+        result.buckets = std::move(worker_res.buckets);
+      } else {
+        for (size_t i = 0; i < result.buckets.size(); ++i) {
+          result.buckets[i] += worker_res.buckets[i];
+        }
+      }
+    }
+    Log("...Finish running.");
+
+    if (latency_log_) {
+      latency_log_->Stop();
+      if (const auto dropped = latency_log_->GetDroppedNum(); dropped > 0) {
+        std::cerr << "WARNING: " << dropped << " latency samples were dropped because "
+                  << "the log writer fell behind workers.\n";
+      }
+      Log("...Write " + std::to_string(latency_log_->GetWrittenNum()) + " latency samples.");
+    }
+
+    return result;
+  }
+
+  /**
+   * @brief Run worker threads that hand over their sketches every window.
+   *
+   * The recorder is kept in `recorder_` after this function to output its
+   * trends, so callers must reset it.
+   *
+   * @param window The length of each window.
+   * @param log_path The path of a per-window log (an empty string disables
+   * logging).
+   * @param hdr_log A writer of HdrHistogram interval logs if needed.
+   * @return Merged measurement results.
+   */
+  auto
+  RunRollingWindows(  //
+      const std::chrono::nanoseconds window,
+      const std::string &log_path,
+      component::HdrLogWriter *hdr_log)  //
+      -> Result
+  {
+    std::unique_ptr<component::HeatmapWriter> heatmap{};
+    if (!heatmap_path_.empty()) {
+      heatmap = std::make_unique<component::HeatmapWriter>(heatmap_path_);
+    }
+    recorder_ = std::make_unique<SoakRecorder>(thread_num_, OperationEngine::OPType::kTotalNum,
+                                               window.count(), log_path, hdr_log, heatmap.get());
+    auto &&result = RunWorkers(thread_num_, 0);
+    recorder_->Finish(*std::max_element(result.windows.begin(), result.windows.end()));
+    result.sketch = recorder_->GetTotalSketch();
+    return result;
+  }
+
+  /**
+   * @brief Monitor per-interval throughput until workers reach steady state.
+   *
+   * @param thread_num The number of worker threads.
+   * @return The detected length of the initial transient [ns] if exists.
+   */
+  auto
+  MonitorWarmUp(  //
+      const size_t thread_num)  //
+      -> std::optional<size_t>
+  {
+    const auto &begin = Clock_t::now();
+    std::vector<double> series{};
+    size_t prev_total = 0;
+    for (auto next = begin + kWarmUpInterval; next <= begin + max_warmup_;
+         next += kWarmUpInterval) {
+      std::this_thread::sleep_until(next);
+      if (SignalHandler::IsInterrupted()) {
+        Log("...Interrupted by a signal.");
+        is_running_.store(false, kRelaxed);
+        break;
+      }
+
+      size_t total = 0;
+      for (size_t i = 0; i < thread_num; ++i) {
+        total += exec_counters_[i].cnt.load(kRelaxed);
+      }
+      series.emplace_back(static_cast<double>(total - prev_total));
+      prev_total = total;
+
+      if (const auto &trunc = component::DetectSteadyState(series); trunc) {
+        Log("...Detect steady state.");
+        return std::chrono::nanoseconds{kWarmUpInterval * *trunc}.count();
+      }
+    }
+
+    Log("...Steady state is not detected within the time limit.");
+    return std::nullopt;
+  }
+
+  /**
+   * @brief Run a worker thread to measure throughput or latency.
+   *
+   * @param result_p A promise of a worker pointer that holds benchmarking results.
+   * @param thread_id A unique thread ID.
+   * @param rand_seed A random seed.
+   * @param interval_nano An interval between operation arrivals [ns].
+   * @param lifetime_nano The lifetime of each worker [ns] (zero means a worker
+   * lives until the deadline).
+   * @note If a lifetime is given, this thread replaces its worker with a new
+   * one every lifetime until the deadline, and its measured window covers all
+   * the workers including their setup and teardown.
+   */
+  void
+  RunWorker(  //
+      std::promise<Result> result_p,
+      const size_t thread_id,
+      const size_t rand_seed,
+      const size_t interval_nano,
+      const size_t lifetime_nano)
+  {
+    const auto is_straggler = thread_id < straggler_num_;
+    const auto &create_worker = [&](const size_t seed) {
+      return std::make_unique<Worker>(target_,
+                                      op_engine_,
+                                      is_running_,
+                                      thread_id,
+                                      seed,
+                                      interval_nano,
+                                      bucket_num_,
+                                      fan_out_,
+                                      use_fan_out_helpers_,
+                                      is_straggler ? &stall_model_ : nullptr);
+    };
+    auto worker = create_worker(rand_seed);
+    worker_cnt_.fetch_add(1, kRelaxed);
+    while (!ready_for_benchmarking_.load(std::memory_order_acquire)) {
+      // the preparation has finished, so wait other workers
+    }
+
+    if (max_warmup_.count() > 0) {
+      worker->WarmUp(is_warming_up_, exec_counters_[thread_id].cnt);
+    }
+    auto *ring = latency_log_ ? latency_log_->GetRing(thread_id) : nullptr;
+    auto *live = (snapshots_ && !recorder_) ? snapshots_->GetSketch(thread_id) : nullptr;
+    if (lifetime_nano == 0) {
+      worker->Measure(start_time_, deadline_, recorder_.get(), ring, live);
+      Result result{};
+      result.windows.emplace_back(worker->GetMeasuredWindow());
+      CollectResult(*worker, is_straggler, result);
+      result_p.set_value(std::move(result));
+      return;
+    }
+
+    // replace workers continuously until the deadline
+    const std::chrono::nanoseconds lifetime{lifetime_nano};
+    std::mt19937_64 seed_gen{rand_seed};
+    Result result{};
+    auto end = std::min(start_time_ + lifetime, deadline_);
+    worker->Measure(start_time_, end, nullptr, ring, live);
+    CollectResult(*worker, is_straggler, result);
+    while (is_running_.load(kRelaxed)) {
+      const auto &now = Clock_t::now();
+      if (now >= deadline_) break;
+      if (live != nullptr) {
+        live->Restart(result.sketch);
+      }
+      worker = create_worker(seed_gen());
+      end = std::min(now + lifetime, deadline_);
+      worker->Measure(now, end, nullptr, ring, live);
+      CollectResult(*worker, is_straggler, result);
+    }
+    worker.reset();
+    result.windows.emplace_back(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock_t::now() - start_time_)
+            .count());
+    result_p.set_value(std::move(result));
+  }
+
+  /**
+   * @brief Tear down a worker and merge its measurement results.
+   *
+   * @param worker A worker that has finished measuring.
+   * @param is_straggler A flag for indicating the worker is a straggler.
+   * @param result Measurement results to be updated.
+   */
+  void
+  CollectResult(  //
+      Worker &worker,
+      const bool is_straggler,
+      Result &result) const
+  {
+    worker.TearDown();
+    result.lifecycle.Add(kSetUpID, 1, worker.GetSetUpTime());
+    result.lifecycle.Add(kTearDownID, 1, worker.GetTearDownTime());
+
+    const auto &sketch = worker.MoveSketch();
+    result.sketch += sketch;
+    result.sub_ops += worker.MoveSubOPSketch();
+    if (straggler_num_ > 0) {
+      (is_straggler ? result.stragglers : result.others) += sketch;
+      result.stall_num += worker.GetStallNum();
+    }
+    result.metrics += worker.MoveMetrics();
+    auto &&buckets = worker.MoveKeyBucketSketches();
+    if (result.buckets.empty()) {
+      result.buckets = std::move(buckets);
+    } else {
+      for (size_t i = 0; i < result.buckets.size(); ++i) {
+        result.buckets[i] += buckets[i];
+      }
+    }
+  }
+
+  /**
+   * @param result Merged measurement results.
+   * @param per_wall_clock A flag for computing throughput from measured
+   * wall-clock windows instead of execution time.
+   * @return Throughput [OPS/s].
+   * @note Closed-loop throughput is computed from the average of total
+   * execution time per worker. Open-loop throughput is computed from the
+   * average measured window because workers may be idle between arrivals, and
+   * so is that of churn tests because it includes setup and teardown.
+   */
+  [[nodiscard]] auto
+  ComputeThroughput(  //
+      const Result &result,
+      const bool per_wall_clock) const  //
+      -> double
+  {
+    if (result.windows.empty()) return 0.0;
+
+    const auto exec_num = static_cast<double>(result.sketch.GetTotalExecNum());
+    auto total_nano = result.sketch.GetTotalExecTime();
+    if (per_wall_clock) {
+      total_nano = std::accumulate(result.windows.begin(), result.windows.end(), 0UL);
+    }
+
+    const auto avg_nano_time = static_cast<double>(total_nano / result.windows.size());
+    return exec_num / (avg_nano_time / 1E9);
+  }
+
+  /**
+   * @brief Compute a throughput score and output it to stdout.
+   *
+   * @param result Merged measurement results.
+   */
+  void
+  LogThroughput(  //
+      const Result &result) const
+  {
+    if (output_as_csv_ && !measure_throughput_) return;
+
+    const auto throughput = ComputeThroughput(result, false);
+
+    if (output_as_csv_) {
+      std::cout << throughput << "\n";
+    } else {
+      std::cout << "Throughput [OPS/s]: " << throughput << "\n";
+    }
+  }
+
+  /**
+   * @brief Output the stability of per-window throughput to stdout.
+   *
+   * A truncated last window is excluded because its throughput is noisy. If
+   * there are too many windows, a bounded sample of them is summarized.
+   *
+   * @param recorder A recorder of rolling windows.
+   */
+  void
+  LogStability(  //
+      const SoakRecorder &recorder) const
+  {
+    if (output_as_csv_ && !measure_throughput_) return;
+
+    const component::ThroughputStability stability{recorder.GetWindowThroughputs(),
+                                                   stability_threshold_};
+    if (stability.GetWindowNum() == 0) return;
+
+    if (output_as_csv_) {
+      std::cout << "windows,mean,cv,min,max,median,slow_fraction\n"
+                << stability.GetWindowNum() << "," << stability.GetMean() << ","
+                << stability.GetCV() << "," << stability.GetMin() << "," << stability.GetMax()
+                << "," << stability.GetMedian() << "," << stability.GetSlowFraction() << "\n";
+      return;
+    }
+
+    const auto window_in_ms = static_cast<double>(recorder.GetWindow()) / 1E6;
+    std::printf("Throughput stability (%zu windows of %.1f ms",  // NOLINT
+                recorder.GetFullWindowNum(), window_in_ms);
+    if (stability.GetWindowNum() < recorder.GetFullWindowNum()) {
+      std::printf(", %zu sampled", stability.GetWindowNum());  // NOLINT
+    }
+    std::printf("):\n");  // NOLINT
+    std::printf("  Mean [OPS/s]:   %.1f\n", stability.GetMean());       // NOLINT
+    std::printf("  CV:             %.4f\n", stability.GetCV());         // NOLINT
+    std::printf("  Min [OPS/s]:    %.1f\n", stability.GetMin());        // NOLINT
+    std::printf("  Max [OPS/s]:    %.1f\n", stability.GetMax());        // NOLINT
+    std::printf("  Median [OPS/s]: %.1f\n", stability.GetMedian());     // NOLINT
+    std::printf("  Below %.0f%% of median: %.2f%%\n",                   // NOLINT
+                stability.GetThreshold() * 100, stability.GetSlowFraction() * 100);
+  }
+
+  /**
+   * @brief Output the detected length of warm-up to stdout.
+   *
+   * @param result Merged measurement results.
+   */
+  void
+  LogWarmUp(  //
+      const Result &result) const
+  {
+    if (output_as_csv_ || max_warmup_.count() == 0) return;
+
+    const auto elapsed = static_cast<double>(result.warmup_elapsed) / 1E9;
+    if (result.warmup) {
+      std::printf("Warm-up [s]: %.3f (detected), %.3f (elapsed)\n",  // NOLINT
+                  static_cast<double>(*result.warmup) / 1E9, elapsed);
+    } else {
+      std::printf("Warm-up [s]: not detected, %.3f (elapsed)\n", elapsed);  // NOLINT
+    }
+  }
+
+  /**
+   * @brief Output measured wall-clock windows of each worker to stdout.
+   *
+   * @param result Merged measurement results.
+   */
+  void
+  LogWindows(  //
+      const Result &result) const
+  {
+    if (output_as_csv_) return;
+
+    Log("Measured Windows [s]:");
+    for (size_t i = 0; i < result.windows.size(); ++i) {
+      std::printf("  Worker %4lu: %12.6f\n",  // NOLINT
+                  i, static_cast<double>(result.windows[i]) / 1E9);
+    }
+  }
+
+  /**
+   * @brief Output execution time of setup and teardown hooks to stdout.
+   *
+   * @param result Merged measurement results.
+   * @param as_table A flag for outputting percentiles over workers also in CSV
+   * format (a churn test) or only the mean and maximum in text format.
+   */
+  void
+  LogLifecycle(  //
+      const Result &result,
+      const bool as_table) const
+  {
+    const auto &lifecycle = result.lifecycle;
+    if (!lifecycle.HasLatency(kSetUpID)) return;
+
+    if (!as_table) {
+      if (output_as_csv_) return;
+      std::printf("Setup/Teardown Time [ns] (%lu workers):\n",  // NOLINT
+                  lifecycle.GetExecNum(kSetUpID));
+      std::printf("  mean: %12.1f, %12.1f\n",  // NOLINT
+                  lifecycle.GetMean(kSetUpID), lifecycle.GetMean(kTearDownID));
+      std::printf("  max:  %12lu, %12lu\n",  // NOLINT
+                  lifecycle.Quantile(kSetUpID, 1.0), lifecycle.Quantile(kTearDownID, 1.0));
+      return;
+    }
+
+    if (output_as_csv_ && measure_throughput_) return;
+    if (output_as_csv_) {
+      std::cout << "quantile,setup,teardown\n";
+    } else {
+      Log("Percentile Setup/Teardown Time [ns]:");
+    }
+    for (auto &&q : target_latency_) {
+      const auto setup = lifecycle.Quantile(kSetUpID, q);
+      const auto teardown = lifecycle.Quantile(kTearDownID, q);
+      if (output_as_csv_) {
+        std::cout << q << "," << setup << "," << teardown << "\n";
+      } else {
+        std::printf("  %6.2f: %12lu, %12lu\n", 100 * q, setup, teardown);  // NOLINT
+      }
     }
   }
 
@@ -412,9 +1555,286 @@ class Benchmarker
           std::cout << id << "," << q << "," << sketch.Quantile(id, q) << "\n";
         }
       }
+      LogSummary(sketch, id);
     }
   }
 
+  /**
+   * @brief Output summary statistics of latency to stdout.
+   *
+   * The confidence interval of the mean assumes independent samples, so it
+   * can be optimistic for autocorrelated latency.
+   *
+   * @param sketch Measured latency.
+   * @param id The ID of a target operation.
+   */
+  void
+  LogSummary(  //
+      const Sketch &sketch,
+      const size_t id) const
+  {
+    if (output_as_csv_) return;
+
+    constexpr double kZ95 = 1.96;
+    const auto sd = sketch.GetStdDev(id);
+    const auto ci = kZ95 * sd / std::sqrt(static_cast<double>(sketch.GetExecNum(id)));
+    std::printf("  Mean: %.1f (95%% CI +-%.1f), SD: %.1f, Skewness: %.2f, Total: %lu\n",  // NOLINT
+                sketch.GetMean(id), ci, sd, sketch.GetSkewness(id), sketch.GetTotalTime(id));
+  }
+
+  /**
+   * @brief Output sub-operation latency and tail amplification to stdout.
+   *
+   * Since a logical operation is recorded with the type of its first
+   * sub-operation, amplification is computed per operation type and is exact
+   * when a logical operation consists of sub-operations of the same type.
+   *
+   * @param result Merged measurement results.
+   */
+  void
+  LogFanOut(  //
+      const Result &result) const
+  {
+    if (fan_out_ <= 1 || (output_as_csv_ && measure_throughput_)) return;
+
+    const auto &logical = result.sketch;
+    const auto &sub_ops = result.sub_ops;
+    if (output_as_csv_) {
+      std::cout << "ops_id,quantile,sub_op,logical,amplification\n";
+    } else {
+      Log("Fan-out Latency (" + std::to_string(fan_out_)
+          + " sub-operations, sub-operation/logical [ns], amplification):");
+    }
+    for (size_t id = 0; id < OperationEngine::OPType::kTotalNum; ++id) {
+      if (!sub_ops.HasLatency(id)) continue;
+      if (!output_as_csv_) {
+        Log(" OPS ID " + std::to_string(id) + ":");
+      }
+      const auto has_logical = logical.HasLatency(id);
+      for (auto &&q : target_latency_) {
+        const auto sub_lat = sub_ops.Quantile(id, q);
+        const auto logical_lat = has_logical ? logical.Quantile(id, q) : 0;
+        const auto ratio = (sub_lat > 0)
+                               ? static_cast<double>(logical_lat) / static_cast<double>(sub_lat)
+                               : 0.0;
+        if (output_as_csv_) {
+          std::cout << id << "," << q << "," << sub_lat << ",";
+          if (has_logical) {
+            std::cout << logical_lat << "," << ratio;
+          } else {
+            std::cout << ",";
+          }
+          std::cout << "\n";
+        } else if (has_logical) {
+          std::printf("  %6.2f: %12lu, %12lu, %8.2fx\n",  // NOLINT
+                      100 * q, sub_lat, logical_lat, ratio);
+        } else {
+          std::printf("  %6.2f: %12lu, %12s, %9s\n", 100 * q, sub_lat, "-", "-");  // NOLINT
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief Output latency of non-straggler workers and stragglers to stdout.
+   *
+   * @param result Merged measurement results.
+   */
+  void
+  LogStragglers(  //
+      const Result &result) const
+  {
+    if (straggler_num_ == 0 || (output_as_csv_ && measure_throughput_)) return;
+
+    const auto &others = result.others;
+    const auto &stragglers = result.stragglers;
+    if (output_as_csv_) {
+      std::cout << "ops_id,quantile,others,stragglers\n";
+    } else {
+      Log("Stragglers (" + std::to_string(straggler_num_) + " workers, "
+          + std::to_string(result.stall_num) + " stalls of "
+          + std::to_string(stall_model_.stall_nano) + " ns, others/stragglers [ns]):");
+    }
+    for (size_t id = 0; id < OperationEngine::OPType::kTotalNum; ++id) {
+      if (!others.HasLatency(id) && !stragglers.HasLatency(id)) continue;
+      if (!output_as_csv_) {
+        Log(" OPS ID " + std::to_string(id) + ":");
+      }
+      for (auto &&q : target_latency_) {
+        const auto other_lat = others.HasLatency(id) ? others.Quantile(id, q) : 0;
+        const auto straggler_lat = stragglers.HasLatency(id) ? stragglers.Quantile(id, q) : 0;
+        if (output_as_csv_) {
+          std::cout << id << "," << q << "," << other_lat << "," << straggler_lat << "\n";
+        } else {
+          std::printf("  %6.2f: %12lu, %12lu\n", 100 * q, other_lat, straggler_lat);  // NOLINT
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief Output target-defined metrics to stdout.
+   *
+   * @param result Merged measurement results.
+   */
+  void
+  LogMetrics(  //
+      const Result &result) const
+  {
+    if (result.metrics.IsEmpty() || (output_as_csv_ && measure_throughput_)) return;
+
+    Log("Target Metrics (counters, or count and p50/p99/max of histograms):");
+    result.metrics.Report(std::cout, output_as_csv_);
+  }
+
+  /**
+   * @brief Output live throughput and latency to stdout.
+   *
+   * @param total Live aggregates of workers' latency.
+   * @param reported_num The number of operations in the last report.
+   * @return The number of operations in this report.
+   */
+  auto
+  LogProgress(  //
+      const Sketch &total,
+      const size_t reported_num) const  //
+      -> size_t
+  {
+    const auto exec_num = total.GetTotalExecNum();
+    const auto interval_sec = std::chrono::duration<double>{progress_interval_}.count();
+    const auto throughput = static_cast<double>(exec_num - reported_num) / interval_sec;
+    std::string msg = "...Progress: " + std::to_string(exec_num) + " operations, "
+                      + std::to_string(static_cast<size_t>(throughput)) + " OPS/s";
+    for (size_t id = 0; id < OperationEngine::OPType::kTotalNum; ++id) {
+      if (!total.HasLatency(id)) continue;
+      msg += ", p99 (ID " + std::to_string(id) + "): " + std::to_string(total.Quantile(id, 0.99))
+             + " ns";
+    }
+    Log(msg);
+    return exec_num;
+  }
+
+  /**
+   * @brief Output throughput and latency for each key bucket to stdout.
+   *
+   * @param result Merged measurement results.
+   */
+  void
+  LogKeyBuckets(  //
+      const Result &result) const
+  {
+    if (result.buckets.empty()) return;
+
+    const auto total_nano = std::accumulate(result.windows.begin(), result.windows.end(), 0UL);
+    const auto avg_sec = static_cast<double>(total_nano / result.windows.size()) / 1E9;
+    if (output_as_csv_) {
+      std::cout << "bucket,ops_id,throughput,p50,p99,max\n";
+    } else {
+      Log("Key Buckets (bucket, OPS ID: throughput [OPS/s], p50/p99/max latency [ns]):");
+    }
+    for (size_t i = 0; i < result.buckets.size(); ++i) {
+      const auto &sketch = result.buckets[i];
+      for (size_t id = 0; id < OperationEngine::OPType::kTotalNum; ++id) {
+        if (!sketch.HasLatency(id)) continue;
+        const auto throughput = static_cast<double>(sketch.GetExecNum(id)) / avg_sec;
+        const auto p50 = sketch.Quantile(id, 0.5);
+        const auto p99 = sketch.Quantile(id, 0.99);
+        const auto max = sketch.Quantile(id, 1.0);
+        if (output_as_csv_) {
+          std::cout << i << "," << id << "," << throughput << "," << p50 << "," << p99 << ","
+                    << max << "\n";
+        } else {
+          std::printf("  %6lu, %2lu: %14.1f, %10lu, %10lu, %12lu\n",  // NOLINT
+                      i, id, throughput, p50, p99, max);
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief Output latency for each probed arrival rate to stdout.
+   *
+   * @param probes Measurement results at probed arrival rates.
+   */
+  void
+  LogProbes(  //
+      const std::vector<Probe> &probes) const
+  {
+    Log("Probed Arrival Rates:");
+    for (const auto &[rate, throughput, satisfied, sketch] : probes) {
+      if (!output_as_csv_) {
+        std::printf("  Rate [OPS/s]: %12.1f, Throughput [OPS/s]: %12.1f, SLOs: %s\n",  // NOLINT
+                    rate, throughput, satisfied ? "satisfied" : "violated");
+      }
+      for (size_t id = 0; id < OperationEngine::OPType::kTotalNum; ++id) {
+        if (!sketch.HasLatency(id)) continue;
+        Log("   OPS ID " + std::to_string(id) + ":");
+        for (auto &&q : target_latency_) {
+          if (!output_as_csv_) {
+            std::printf("    %6.2f: %12lu\n", 100 * q, sketch.Quantile(id, q));  // NOLINT
+          } else {
+            std::cout << rate << "," << throughput << "," << id << "," << q << ","
+                      << sketch.Quantile(id, q) << "\n";
+          }
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief Output the drift of per-window measurements to stdout.
+   *
+   * Each metric is reported as fitted values at the first and last windows of
+   * a linear trend so that a few noisy windows do not dominate the drift.
+   *
+   * @param recorder A recorder of rolling windows.
+   */
+  void
+  LogDrift(  //
+      const SoakRecorder &recorder) const
+  {
+    const auto last = static_cast<double>(recorder.GetWindowNum()) - 1.0;
+    const auto &log_trend = [&](const std::string &metric, const component::LinearTrend &trend) {
+      if (trend.GetSampleNum() == 0) return;
+      const auto first_val = trend.Predict(0.0);
+      const auto last_val = trend.Predict(last);
+      const auto change = (first_val > 0) ? (last_val - first_val) / first_val * 100 : 0.0;
+      if (output_as_csv_) {
+        std::cout << metric << "," << first_val << "," << last_val << "," << change << "\n";
+      } else {
+        std::printf("  %-28s %14.1f -> %14.1f (%+.2f%%)\n",  // NOLINT
+                    (metric + ":").c_str(), first_val, last_val, change);
+      }
+    };
+
+    if (output_as_csv_) {
+      std::cout << "metric,first,last,change\n";
+    } else {
+      Log("Drift over " + std::to_string(recorder.GetWindowNum())
+          + " windows (linear fit, first -> last):");
+    }
+    log_trend("Throughput [OPS/s]", recorder.GetThroughputTrend());
+    log_trend("RSS [bytes]", recorder.GetRSSTrend());
+    for (size_t id = 0; id < OperationEngine::OPType::kTotalNum; ++id) {
+      log_trend("OPS ID " + std::to_string(id) + " p99 [ns]", recorder.GetLatencyTrend(id));
+    }
+  }
+
+  /**
+   * @brief Output a warning if benchmarking has been interrupted by a signal.
+   *
+   * The warning is always written to stderr so that CSV outputs are also
+   * distinguishable from complete results.
+   */
+  void
+  LogInterruption() const
+  {
+    if (!SignalHandler::IsInterrupted()) return;
+
+    std::cerr << "WARNING: interrupted by a signal, so the following results are partial.\n";
+    Log("*** PARTIAL RESULTS ***");
+  }
+
   /**
    * @brief Log a message to stdout if the output mode is `text`.
    *
@@ -454,20 +1874,91 @@ class Benchmarker
   /// @brief The number of benchmark-ready workers.
   std::atomic_size_t worker_cnt_{};
 
+  /// @brief The number of executed operations of each worker during warm-up.
+  std::unique_ptr<component::PaddedCounter[]> exec_counters_{};
+
+  /// @brief A writer of raw latency logs.
+  std::unique_ptr<component::LatencyLog> latency_log_{};
+
+  /// @brief A recorder of rolling windows for soak tests.
+  std::unique_ptr<SoakRecorder> recorder_{};
+
+  /// @brief A collector of live snapshots for progress reports.
+  std::unique_ptr<component::SnapshotCollector> snapshots_{};
+
   /// @brief A flag for waking up worker threads.
   std::atomic_bool ready_for_benchmarking_{};
 
   /// @brief A flag for interrupting workers.
-  std::atomic_bool is_running_{};
+  /// @note This flag and `is_warming_up_` are read by all the workers during
+  /// benchmarking, so they are isolated from the other members.
+  alignas(component::kCacheLineSize) std::atomic_bool is_running_{};
+
+  /// @brief A flag for indicating the warm-up phase.
+  std::atomic_bool is_warming_up_{};
 
   /// @brief Seconds to timeout.
-  const std::chrono::seconds timeout_in_sec_{};
+  alignas(component::kCacheLineSize) const std::chrono::seconds timeout_in_sec_{};
+
+  /// @brief The maximum seconds for warming up.
+  const std::chrono::seconds max_warmup_{};
+
+  /// @brief The common timestamp for workers to start measuring.
+  Clock_t::time_point start_time_{};
+
+  /// @brief The common deadline for workers to stop measuring.
+  Clock_t::time_point deadline_{};
 
   /// @brief A flat to output measured results as CSV or TXT.
   const bool output_as_csv_{};
 
   /// @brief A flag to measure throughput (if true) or latency (if false).
   const bool measure_throughput_{};
+
+  /// @brief A flag to report the environment and run pre-flight checks.
+  const bool check_env_{};
+
+  /// @brief A flag to abort benchmarks if the machine is noisy.
+  const bool abort_if_noisy_{};
+
+  /// @brief The path of an HdrHistogram log.
+  const std::string hdr_log_path_{};
+
+  /// @brief The number of key buckets.
+  const size_t bucket_num_{};
+
+  /// @brief The path of a heatmap.
+  const std::string heatmap_path_{};
+
+  /// @brief The length of each time window in heatmaps.
+  const std::chrono::milliseconds heatmap_window_{};
+
+  /// @brief The path of a serialized sketch.
+  const std::string sketch_path_{};
+
+  /// @brief The interval between progress reports.
+  const std::chrono::milliseconds progress_interval_{};
+
+  /// @brief The length of each window for stability.
+  const std::chrono::milliseconds stability_window_{};
+
+  /// @brief A ratio to the median for detecting slow windows.
+  const double stability_threshold_{};
+
+  /// @brief The number of sub-operations per logical operation.
+  const size_t fan_out_{};
+
+  /// @brief A flag for issuing sub-operations in parallel by helper threads.
+  const bool use_fan_out_helpers_{};
+
+  /// @brief The number of straggler workers.
+  const size_t straggler_num_{};
+
+  /// @brief A model of periodic stalls of stragglers.
+  const component::StallModel stall_model_{};
+
+  /// @brief Merged latency of the last run.
+  Sketch sketch_{};
 };
 
 }  // namespace dbgroup::benchmark
@@ -0,0 +1,48 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DBGROUP_BENCHMARK_COMPONENT_COMMON_HPP_
+#define DBGROUP_BENCHMARK_COMPONENT_COMMON_HPP_
+
+// C++ standard libraries
+#include <atomic>
+#include <cstddef>
+
+namespace dbgroup::benchmark::component
+{
+/*############################################################################*
+ * Global constants
+ *############################################################################*/
+
+/// @brief The expected cache line size for avoiding false sharing.
+constexpr size_t kCacheLineSize = 64;
+
+/*############################################################################*
+ * Global types
+ *############################################################################*/
+
+/**
+ * @brief A counter that is updated by a single worker and read by others.
+ *
+ */
+struct alignas(kCacheLineSize) PaddedCounter {
+  /// @brief A counter isolated in a cache line.
+  std::atomic_size_t cnt{};
+};
+
+}  // namespace dbgroup::benchmark::component
+
+#endif  // DBGROUP_BENCHMARK_COMPONENT_COMMON_HPP_
@@ -0,0 +1,217 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DBGROUP_BENCHMARK_COMPONENT_COMPARISON_HPP_
+#define DBGROUP_BENCHMARK_COMPONENT_COMPARISON_HPP_
+
+// C++ standard libraries
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// local sources
+#include "dbgroup/benchmark/component/measurements.hpp"
+
+namespace dbgroup::benchmark::component
+{
+/**
+ * @brief A class for comparing latency distributions of two runs.
+ *
+ * This class compares the distributions of a given operation type in two
+ * sketches using only their bins, so it works for both in-process sketches and
+ * sketches read by `SimpleDDSketch::Deserialize`. It computes the following
+ * metrics:
+ *
+ * - the Kolmogorov-Smirnov distance (the maximum gap between two CDFs),
+ * - the Wasserstein-1 distance (the area between two CDFs) [ns], and
+ * - the ratio curve of target to base latency for each percentile.
+ */
+class DistributionComparison
+{
+ public:
+  /*##########################################################################*
+   * Public types
+   *##########################################################################*/
+
+  /**
+   * @brief A point of a percentile-wise ratio curve.
+   *
+   */
+  struct QuantileRatio {
+    /// @brief A quantile.
+    double q{};
+
+    /// @brief The latency of a base distribution [ns].
+    size_t base{};
+
+    /// @brief The latency of a target distribution [ns].
+    size_t target{};
+
+    /// @brief The ratio of target to base latency.
+    double ratio{};
+  };
+
+  /*##########################################################################*
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  /**
+   * @brief Compare the distributions of a given operation type.
+   *
+   * @param base A base sketch.
+   * @param target A target sketch.
+   * @param ops_id The ID of a target operation.
+   * @note If either sketch has no latency of a target operation, all the
+   * metrics are set to zero and the ratio curve is empty.
+   */
+  DistributionComparison(  //
+      const SimpleDDSketch &base,
+      const SimpleDDSketch &target,
+      size_t ops_id);
+
+  DistributionComparison(const DistributionComparison &) = default;
+  DistributionComparison(DistributionComparison &&) = default;
+
+  auto operator=(const DistributionComparison &obj) -> DistributionComparison & = default;
+  auto operator=(DistributionComparison &&) -> DistributionComparison & = default;
+
+  /*##########################################################################*
+   * Public destructors
+   *##########################################################################*/
+
+  ~DistributionComparison() = default;
+
+  /*##########################################################################*
+   * Public APIs
+   *##########################################################################*/
+
+  /**
+   * @return The Kolmogorov-Smirnov distance in [0, 1].
+   */
+  [[nodiscard]] constexpr auto
+  GetKSDistance() const  //
+      -> double
+  {
+    return ks_distance_;
+  }
+
+  /**
+   * @return The latency where two CDFs diverge most [ns].
+   */
+  [[nodiscard]] constexpr auto
+  GetKSLatency() const  //
+      -> size_t
+  {
+    return ks_latency_;
+  }
+
+  /**
+   * @return The Wasserstein-1 distance [ns].
+   */
+  [[nodiscard]] constexpr auto
+  GetWassersteinDistance() const  //
+      -> double
+  {
+    return wasserstein_;
+  }
+
+  /**
+   * @return The ratio curve of target to base latency.
+   */
+  [[nodiscard]] constexpr auto
+  GetRatioCurve() const  //
+      -> const std::vector<QuantileRatio> &
+  {
+    return ratios_;
+  }
+
+  /**
+   * @param num The maximum number of quantiles to be returned.
+   * @return Quantiles in descending order of their divergence (i.e., the
+   * absolute log ratio of target to base latency).
+   */
+  [[nodiscard]] auto GetMostDivergentQuantiles(  //
+      size_t num) const                          //
+      -> std::vector<QuantileRatio>;
+
+  /**
+   * @brief Output the metrics and the most divergent quantiles.
+   *
+   * @param os An output stream.
+   * @param label A label of compared distributions (e.g., an operation name).
+   * @param num The number of quantiles to be output.
+   */
+  void Report(  //
+      std::ostream &os,
+      const std::string &label,
+      size_t num = kDefaultReportNum) const;
+
+  /**
+   * @brief Compare all the operation types in two sketches and output them.
+   *
+   * @param os An output stream.
+   * @param base A base sketch.
+   * @param target A target sketch.
+   */
+  static void Report(  //
+      std::ostream &os,
+      const SimpleDDSketch &base,
+      const SimpleDDSketch &target);
+
+  /**
+   * @brief Compare two sketches written by `SimpleDDSketch::Serialize`.
+   *
+   * @param os An output stream.
+   * @param base_path The path of a base sketch.
+   * @param target_path The path of a target sketch.
+   * @retval true if both sketches are read and compared.
+   * @retval false otherwise.
+   */
+  static auto ReportFiles(  //
+      std::ostream &os,
+      const std::string &base_path,
+      const std::string &target_path)  //
+      -> bool;
+
+ private:
+  /*##########################################################################*
+   * Internal constants
+   *##########################################################################*/
+
+  /// @brief The default number of quantiles to be reported.
+  static constexpr size_t kDefaultReportNum = 3;
+
+  /*##########################################################################*
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief The Kolmogorov-Smirnov distance.
+  double ks_distance_{};
+
+  /// @brief The latency where two CDFs diverge most.
+  size_t ks_latency_{};
+
+  /// @brief The Wasserstein-1 distance.
+  double wasserstein_{};
+
+  /// @brief The ratio curve of target to base latency.
+  std::vector<QuantileRatio> ratios_{};
+};
+
+}  // namespace dbgroup::benchmark::component
+
+#endif  // DBGROUP_BENCHMARK_COMPONENT_COMPARISON_HPP_
@@ -0,0 +1,145 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DBGROUP_BENCHMARK_COMPONENT_DELAY_HPP_
+#define DBGROUP_BENCHMARK_COMPONENT_DELAY_HPP_
+
+// C++ standard libraries
+#include <cstddef>
+#include <cstdint>
+#include <random>
+
+namespace dbgroup::benchmark::component
+{
+/**
+ * @brief A model of injected delays.
+ *
+ * A delay is sampled from a base distribution, and a spike is added with a
+ * given probability to model occasional stalls (e.g., I/O or page faults).
+ */
+struct DelayModel {
+  /*##########################################################################*
+   * Public types
+   *##########################################################################*/
+
+  /**
+   * @brief Supported base distributions.
+   *
+   */
+  enum Type : uint8_t {
+    kConstant = 0,
+    kUniform,
+    kExponential,
+  };
+
+  /*##########################################################################*
+   * Public APIs
+   *##########################################################################*/
+
+  /**
+   * @param rand A random number generator.
+   * @return A sampled delay [ns].
+   */
+  [[nodiscard]] auto Sample(  //
+      std::mt19937_64 &rand) const  //
+      -> size_t;
+
+  /*##########################################################################*
+   * Public member variables
+   *##########################################################################*/
+
+  /// @brief A base distribution.
+  Type type{kConstant};
+
+  /// @brief A constant delay, the minimum of uniform delays, or the mean of
+  /// exponential delays [ns].
+  size_t delay_nano{0};
+
+  /// @brief The width of uniform delays [ns].
+  size_t spread_nano{0};
+
+  /// @brief The probability of adding a spike to each delay.
+  double spike_prob{0.0};
+
+  /// @brief The length of spikes [ns].
+  size_t spike_nano{0};
+};
+
+/**
+ * @brief A utility class for busy-waiting with calibrated spin loops.
+ *
+ * Reading a clock costs tens of nanoseconds, so this class spins a loop whose
+ * speed is calibrated once per process. Long delays are split into calibrated
+ * chunks and checked against a clock between them so that frequency changes
+ * do not accumulate errors.
+ */
+class SpinDelay
+{
+ public:
+  /*##########################################################################*
+   * Public APIs
+   *##########################################################################*/
+
+  /**
+   * @brief Busy-wait for a given duration.
+   *
+   * @param nano A duration to wait [ns].
+   */
+  static void Wait(  //
+      size_t nano);
+
+  /**
+   * @return The calibrated number of loop iterations per nanosecond.
+   */
+  [[nodiscard]] static auto GetIterPerNano()  //
+      -> double;
+
+ private:
+  /*##########################################################################*
+   * Internal constants
+   *##########################################################################*/
+
+  /// @brief Delays longer than this are checked against a clock [ns].
+  static constexpr size_t kChunkNano = 2000;
+
+  /// @brief The number of iterations for each calibration trial.
+  static constexpr size_t kCalibrationIterNum = 100000;
+
+  /// @brief The number of calibration trials.
+  static constexpr size_t kCalibrationTrialNum = 11;
+
+  /*##########################################################################*
+   * Internal utility functions
+   *##########################################################################*/
+
+  /**
+   * @brief Spin a given number of loop iterations.
+   *
+   * @param iter_num The number of iterations.
+   */
+  static void Spin(  //
+      size_t iter_num);
+
+  /**
+   * @return The measured number of loop iterations per nanosecond.
+   */
+  static auto Calibrate()  //
+      -> double;
+};
+
+}  // namespace dbgroup::benchmark::component
+
+#endif  // DBGROUP_BENCHMARK_COMPONENT_DELAY_HPP_
@@ -0,0 +1,204 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DBGROUP_BENCHMARK_COMPONENT_ENVIRONMENT_HPP_
+#define DBGROUP_BENCHMARK_COMPONENT_ENVIRONMENT_HPP_
+
+// C++ standard libraries
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace dbgroup::benchmark::component
+{
+/**
+ * @brief Get compiler information of a translation unit including this header.
+ *
+ * This function is inlined into benchmark programs, so it reports the compiler
+ * and optimization settings of benchmarking code rather than this library.
+ *
+ * @return Compiler information.
+ */
+inline auto
+GetCompilerInfo()  //
+    -> std::string
+{
+  std::string info{};
+#ifdef __VERSION__
+  info += __VERSION__;
+#else
+  info += "unknown compiler";
+#endif
+#ifdef __OPTIMIZE__
+  info += ", optimized";
+#else
+  info += ", not optimized";
+#endif
+#ifdef NDEBUG
+  info += ", NDEBUG";
+#endif
+#if defined(__AVX512F__)
+  info += ", AVX-512";
+#elif defined(__AVX2__)
+  info += ", AVX2";
+#elif defined(__SSE4_2__)
+  info += ", SSE4.2";
+#elif defined(__ARM_NEON)
+  info += ", NEON";
+#endif
+  return info;
+}
+
+/**
+ * @brief A class for capturing a benchmarking environment and checking noise.
+ *
+ * This class reports hardware and software settings that often invalidate
+ * benchmark results (e.g., CPU frequency scaling and turbo boost) and performs
+ * a short spin measurement on worker threads to detect busy neighbors.
+ */
+class Environment
+{
+ public:
+  /*##########################################################################*
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  /**
+   * @brief Capture the current environment.
+   *
+   * @param compiler_info Compiler information of benchmarking code.
+   */
+  explicit Environment(  //
+      std::string compiler_info);
+
+  Environment(const Environment &) = default;
+  Environment(Environment &&) = default;
+
+  auto operator=(const Environment &obj) -> Environment & = default;
+  auto operator=(Environment &&) -> Environment & = default;
+
+  /*##########################################################################*
+   * Public destructors
+   *##########################################################################*/
+
+  ~Environment() = default;
+
+  /*##########################################################################*
+   * Public APIs
+   *##########################################################################*/
+
+  /**
+   * @brief Run pre-flight checks for a given number of worker threads.
+   *
+   * @param thread_num The number of worker threads.
+   */
+  void CheckNoise(  //
+      size_t thread_num);
+
+  /**
+   * @retval true if pre-flight checks found noise that invalidates results.
+   * @retval false otherwise.
+   */
+  [[nodiscard]] constexpr auto
+  IsNoisy() const  //
+      -> bool
+  {
+    return is_noisy_;
+  }
+
+  /**
+   * @return Warnings found by pre-flight checks.
+   */
+  [[nodiscard]] constexpr auto
+  GetWarnings() const  //
+      -> const std::vector<std::string> &
+  {
+    return warnings_;
+  }
+
+  /**
+   * @brief Output the captured environment.
+   *
+   * @param os An output stream.
+   */
+  void Report(  //
+      std::ostream &os) const;
+
+ private:
+  /*##########################################################################*
+   * Internal constants
+   *##########################################################################*/
+
+  /// @brief The number of iterations for each spin measurement.
+  static constexpr size_t kSpinNum = 100000;
+
+  /// @brief The number of spin measurements per thread.
+  static constexpr size_t kTrialNum = 20;
+
+  /// @brief The acceptable ratio of the slowest spin to the fastest one.
+  static constexpr double kSpinTolerance = 1.2;
+
+  /*##########################################################################*
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief The model name of CPUs.
+  std::string cpu_model_{};
+
+  /// @brief The number of logical CPUs.
+  size_t cpu_num_{};
+
+  /// @brief A CPU frequency governor.
+  std::string governor_{};
+
+  /// @brief The state of turbo boost.
+  std::string turbo_{};
+
+  /// @brief The state of simultaneous multithreading.
+  std::string smt_{};
+
+  /// @brief Isolated CPUs.
+  std::string isolated_cpus_{};
+
+  /// @brief Load averages for 1, 5, and 15 minutes.
+  std::vector<double> load_avg_{};
+
+  /// @brief Kernel information.
+  std::string kernel_{};
+
+  /// @brief Compiler information of benchmarking code.
+  std::string compiler_info_{};
+
+  /// @brief Build settings of this library.
+  std::string build_info_{};
+
+  /// @brief The fastest spin time in pre-flight checks [ns].
+  size_t min_spin_{};
+
+  /// @brief The slowest spin time in pre-flight checks [ns].
+  size_t max_spin_{};
+
+  /// @brief Warnings found by pre-flight checks.
+  std::vector<std::string> warnings_{};
+
+  /// @brief A flag for indicating noise.
+  bool is_noisy_{false};
+};
+
+}  // namespace dbgroup::benchmark::component
+
+#endif  // DBGROUP_BENCHMARK_COMPONENT_ENVIRONMENT_HPP_
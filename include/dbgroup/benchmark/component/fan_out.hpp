@@ -0,0 +1,268 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DBGROUP_BENCHMARK_COMPONENT_FAN_OUT_HPP_
+#define DBGROUP_BENCHMARK_COMPONENT_FAN_OUT_HPP_
+
+// C++ standard libraries
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// local sources
+#include "dbgroup/benchmark/component/common.hpp"
+
+namespace dbgroup::benchmark::component
+{
+/**
+ * @brief A measurement result of a sub-operation.
+ *
+ */
+struct SubOPResult {
+  /// @brief The type of a sub-operation.
+  size_t type{};
+
+  /// @brief The number of executions for throughput.
+  size_t cnt{};
+
+  /// @brief Measured latency [ns].
+  size_t lat{};
+};
+
+/**
+ * @brief A group of helper threads for issuing sub-operations in parallel.
+ *
+ * A worker fills a batch of sub-operations, executes the first one by itself,
+ * and hands over the others to helpers. Each helper has its own request and
+ * acknowledgement counters, so neither side uses atomic read-modify-write
+ * operations. Helpers busy-wait for requests to avoid wake-up delays, so each
+ * of them occupies a logical CPU during measurements.
+ *
+ * @tparam OPs The type of operations yielded by operation iterators.
+ */
+template <class OPs>
+class FanOutGroup
+{
+ public:
+  /*##########################################################################*
+   * Type aliases
+   *##########################################################################*/
+
+  using Executor = std::function<SubOPResult(const OPs &)>;
+  using SetUpHook = std::function<void(size_t)>;
+  using Hook = std::function<void()>;
+
+  /*##########################################################################*
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  /**
+   * @brief Create helper threads.
+   *
+   * @param helper_num The number of helper threads.
+   * @param set_up A function called on each helper thread before execution
+   * with the ID of a helper.
+   * @param exec A function for executing and measuring a sub-operation.
+   * @param tear_down A function called on each helper thread before exit.
+   */
+  FanOutGroup(  //
+      const size_t helper_num,
+      SetUpHook set_up,
+      Executor exec,
+      Hook tear_down)
+      : slots_{std::make_unique<Slot[]>(helper_num)},  // NOLINT
+        set_up_{std::move(set_up)},
+        exec_{std::move(exec)},
+        tear_down_{std::move(tear_down)}
+  {
+    ops_.reserve(helper_num + 1);
+    helpers_.reserve(helper_num);
+    for (size_t i = 0; i < helper_num; ++i) {
+      helpers_.emplace_back([this, i]() { RunHelper(i); });
+    }
+  }
+
+  FanOutGroup(const FanOutGroup &) = delete;
+  FanOutGroup(FanOutGroup &&) = delete;
+
+  auto operator=(const FanOutGroup &obj) -> FanOutGroup & = delete;
+  auto operator=(FanOutGroup &&) -> FanOutGroup & = delete;
+
+  /*##########################################################################*
+   * Public destructors
+   *##########################################################################*/
+
+  /**
+   * @brief Stop and join helper threads.
+   *
+   */
+  ~FanOutGroup()
+  {
+    for (size_t i = 0; i < helpers_.size(); ++i) {
+      slots_[i].requested.store(kStop, std::memory_order_release);
+    }
+    for (auto &&t : helpers_) {
+      t.join();
+    }
+  }
+
+  /*##########################################################################*
+   * Public APIs
+   *##########################################################################*/
+
+  /**
+   * @return A batch of sub-operations to be filled before `Issue`.
+   * @note The batch must not exceed the number of helpers plus one.
+   */
+  [[nodiscard]] auto
+  GetOPs()  //
+      -> std::vector<OPs> &
+  {
+    return ops_;
+  }
+
+  /**
+   * @brief Hand over the sub-operations except the first one to helpers.
+   *
+   */
+  void
+  Issue()
+  {
+    issued_num_ = ops_.size() - 1;
+    for (size_t i = 0; i < issued_num_; ++i) {
+      auto &slot = slots_[i];
+      slot.requested.store(++slot.seq, std::memory_order_release);
+    }
+  }
+
+  /**
+   * @brief Wait for helpers to finish the issued sub-operations.
+   *
+   */
+  void
+  Wait() const
+  {
+    for (size_t i = 0; i < issued_num_; ++i) {
+      const auto &slot = slots_[i];
+      while (slot.acked.load(std::memory_order_acquire) != slot.seq) {
+        // wait for the helper to finish its sub-operation
+      }
+    }
+  }
+
+  /**
+   * @param pos The position of a sub-operation in the last batch (from one).
+   * @return The measurement result of a given sub-operation.
+   */
+  [[nodiscard]] auto
+  GetResult(  //
+      const size_t pos) const  //
+      -> const SubOPResult &
+  {
+    return slots_[pos - 1].result;
+  }
+
+ private:
+  /*##########################################################################*
+   * Internal constants
+   *##########################################################################*/
+
+  /// @brief A special request for stopping helpers.
+  static constexpr uint64_t kStop = ~0UL;
+
+  /*##########################################################################*
+   * Internal classes
+   *##########################################################################*/
+
+  /**
+   * @brief A communication slot between a worker and a helper.
+   *
+   */
+  struct alignas(kCacheLineSize) Slot {
+    /// @brief The last issued sequence number (only used by a worker).
+    uint64_t seq{0};
+
+    /// @brief A sequence number requested by a worker.
+    std::atomic_uint64_t requested{0};
+
+    /// @brief A sequence number acknowledged by a helper.
+    std::atomic_uint64_t acked{0};
+
+    /// @brief The measurement result of the last sub-operation.
+    SubOPResult result{};
+  };
+
+  /*##########################################################################*
+   * Internal utility functions
+   *##########################################################################*/
+
+  /**
+   * @brief Execute requested sub-operations until stopped.
+   *
+   * @param id The ID of a helper.
+   */
+  void
+  RunHelper(  //
+      const size_t id)
+  {
+    auto &slot = slots_[id];
+    set_up_(id);
+    for (uint64_t done = 0;;) {
+      const auto req = slot.requested.load(std::memory_order_acquire);
+      if (req == done) continue;
+      if (req == kStop) break;
+
+      slot.result = exec_(ops_[id + 1]);
+      done = req;
+      slot.acked.store(done, std::memory_order_release);
+    }
+    tear_down_();
+  }
+
+  /*##########################################################################*
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief A batch of sub-operations.
+  std::vector<OPs> ops_{};
+
+  /// @brief The number of sub-operations handed over to helpers.
+  size_t issued_num_{0};
+
+  /// @brief Communication slots for each helper.
+  std::unique_ptr<Slot[]> slots_{};  // NOLINT
+
+  /// @brief A function called on each helper thread before execution.
+  SetUpHook set_up_{};
+
+  /// @brief A function for executing and measuring a sub-operation.
+  Executor exec_{};
+
+  /// @brief A function called on each helper thread before exit.
+  Hook tear_down_{};
+
+  /// @brief Helper threads.
+  std::vector<std::thread> helpers_{};
+};
+
+}  // namespace dbgroup::benchmark::component
+
+#endif  // DBGROUP_BENCHMARK_COMPONENT_FAN_OUT_HPP_
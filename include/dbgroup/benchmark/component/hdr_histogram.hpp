@@ -0,0 +1,135 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DBGROUP_BENCHMARK_COMPONENT_HDR_HISTOGRAM_HPP_
+#define DBGROUP_BENCHMARK_COMPONENT_HDR_HISTOGRAM_HPP_
+
+// C++ standard libraries
+#include <cstddef>
+#include <fstream>
+#include <string>
+
+// local sources
+#include "dbgroup/benchmark/component/measurements.hpp"
+
+namespace dbgroup::benchmark::component
+{
+/*############################################################################*
+ * Global utilities
+ *############################################################################*/
+
+/**
+ * @brief Encode the latency of a given operation as an HdrHistogram [1].
+ *
+ * Each bin of a sketch is recorded at its representative latency (clamped by
+ * the exact minimum and maximum) into a histogram with two significant digits,
+ * which is finer than the relative error of the sketch. The result uses the V2
+ * compressed encoding of HdrHistogram (a zlib stream of stored blocks) and is
+ * encoded by Base64 as in interval logs.
+ *
+ * [1] http://hdrhistogram.org/
+ *
+ * @param sketch Measured latency.
+ * @param ops_id The ID of a target operation.
+ * @return An encoded histogram.
+ */
+[[nodiscard]] auto EncodeHdrHistogram(  //
+    const SimpleDDSketch &sketch,
+    size_t ops_id)  //
+    -> std::string;
+
+/**
+ * @brief A class for writing HdrHistogram interval logs.
+ *
+ * Each interval is tagged with its operation ID (e.g., `Tag=OPS_ID_0`), and
+ * interval maximums are written in milliseconds as the default of
+ * HdrHistogram's `HistogramLogWriter`.
+ */
+class HdrLogWriter
+{
+ public:
+  /*##########################################################################*
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  /**
+   * @brief Open a new log file and write its header.
+   *
+   * @param path The path of an output log file.
+   * @note If the file cannot be opened, a warning is written to stderr and
+   * `IsOpen` returns false.
+   */
+  explicit HdrLogWriter(  //
+      const std::string &path);
+
+  HdrLogWriter(const HdrLogWriter &) = delete;
+  HdrLogWriter(HdrLogWriter &&) = delete;
+
+  auto operator=(const HdrLogWriter &obj) -> HdrLogWriter & = delete;
+  auto operator=(HdrLogWriter &&) -> HdrLogWriter & = delete;
+
+  /*##########################################################################*
+   * Public destructors
+   *##########################################################################*/
+
+  ~HdrLogWriter() = default;
+
+  /*##########################################################################*
+   * Public APIs
+   *##########################################################################*/
+
+  /**
+   * @retval true if the log file is writable.
+   * @retval false otherwise.
+   */
+  [[nodiscard]] auto
+  IsOpen() const  //
+      -> bool
+  {
+    return ofs_.is_open();
+  }
+
+  /**
+   * @brief Write intervals of all the executed operations in a given sketch.
+   *
+   * @param sketch Measured latency in an interval.
+   * @param start_sec The start of the interval relative to the log [s].
+   * @param length_sec The length of the interval [s].
+   */
+  void Write(  //
+      const SimpleDDSketch &sketch,
+      double start_sec,
+      double length_sec);
+
+ private:
+  /*##########################################################################*
+   * Internal constants
+   *##########################################################################*/
+
+  /// @brief The ratio for converting maximum latency into milliseconds.
+  static constexpr double kMaxValueUnitRatio = 1E6;
+
+  /*##########################################################################*
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief An output log file.
+  std::ofstream ofs_{};
+};
+
+}  // namespace dbgroup::benchmark::component
+
+#endif  // DBGROUP_BENCHMARK_COMPONENT_HDR_HISTOGRAM_HPP_
@@ -0,0 +1,121 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DBGROUP_BENCHMARK_COMPONENT_HEATMAP_HPP_
+#define DBGROUP_BENCHMARK_COMPONENT_HEATMAP_HPP_
+
+// C++ standard libraries
+#include <cstddef>
+#include <fstream>
+#include <string>
+
+// local sources
+#include "dbgroup/benchmark/component/measurements.hpp"
+
+namespace dbgroup::benchmark::component
+{
+/**
+ * @brief A class for writing latency-over-time heatmaps.
+ *
+ * A heatmap is a 2-D histogram of time windows and latency columns for each
+ * operation type. Each column merges `kBinsPerColumn` adjacent bins of
+ * `SimpleDDSketch`, so columns have logarithmic widths (about 17%). The file
+ * consists of the following lines:
+ *
+ * - `# upper_bounds_ns,<b_0>,<b_1>,...`: the inclusive upper bound of each
+ *   column.
+ * - `window,start_sec,ops_id,first_col,counts`: a header of rows.
+ * - rows of the header, where `counts` is a space-separated list of counts
+ *   from `first_col` to the last non-empty column in the window.
+ */
+class HeatmapWriter
+{
+ public:
+  /*##########################################################################*
+   * Public constants
+   *##########################################################################*/
+
+  /// @brief The number of sketch bins merged into each column.
+  static constexpr size_t kBinsPerColumn = 8;
+
+  /// @brief The number of columns.
+  static constexpr size_t kColumnNum = SimpleDDSketch::kBinNum / kBinsPerColumn;
+
+  /*##########################################################################*
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  /**
+   * @brief Open a new heatmap file and write its header.
+   *
+   * @param path The path of an output file.
+   * @note If the file cannot be opened, a warning is written to stderr and
+   * `IsOpen` returns false.
+   */
+  explicit HeatmapWriter(  //
+      const std::string &path);
+
+  HeatmapWriter(const HeatmapWriter &) = delete;
+  HeatmapWriter(HeatmapWriter &&) = delete;
+
+  auto operator=(const HeatmapWriter &obj) -> HeatmapWriter & = delete;
+  auto operator=(HeatmapWriter &&) -> HeatmapWriter & = delete;
+
+  /*##########################################################################*
+   * Public destructors
+   *##########################################################################*/
+
+  ~HeatmapWriter() = default;
+
+  /*##########################################################################*
+   * Public APIs
+   *##########################################################################*/
+
+  /**
+   * @retval true if the file is writable.
+   * @retval false otherwise.
+   */
+  [[nodiscard]] auto
+  IsOpen() const  //
+      -> bool
+  {
+    return ofs_.is_open();
+  }
+
+  /**
+   * @brief Write rows of a time window for all the executed operations.
+   *
+   * @param sketch Measured latency in the window.
+   * @param window_id The ID of the window.
+   * @param start_sec The start of the window relative to measurement [s].
+   */
+  void Write(  //
+      const SimpleDDSketch &sketch,
+      size_t window_id,
+      double start_sec);
+
+ private:
+  /*##########################################################################*
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief An output file.
+  std::ofstream ofs_{};
+};
+
+}  // namespace dbgroup::benchmark::component
+
+#endif  // DBGROUP_BENCHMARK_COMPONENT_HEATMAP_HPP_
@@ -0,0 +1,348 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DBGROUP_BENCHMARK_COMPONENT_LATENCY_LOG_HPP_
+#define DBGROUP_BENCHMARK_COMPONENT_LATENCY_LOG_HPP_
+
+// C++ standard libraries
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+
+// local sources
+#include "dbgroup/benchmark/component/common.hpp"
+
+namespace dbgroup::benchmark::component
+{
+/**
+ * @brief A record of a single operation in raw latency logs.
+ *
+ */
+struct LatencyRecord {
+  /// @brief The timestamp when an operation finished [ns since the epoch].
+  uint64_t timestamp{};
+
+  /// @brief Measured latency [ns].
+  uint64_t latency{};
+
+  /// @brief The ID of a worker thread.
+  uint32_t thread_id{};
+
+  /// @brief The ID of an operation type.
+  uint32_t ops_id{};
+};
+
+/**
+ * @brief A lock-free single-producer/single-consumer ring buffer of latency
+ * records.
+ *
+ * A worker pushes records and a background writer pops them. If the buffer is
+ * full, a new record is dropped and counted instead of blocking the worker.
+ */
+class LatencyRing
+{
+ public:
+  /*##########################################################################*
+   * Public constants
+   *##########################################################################*/
+
+  /// @brief The capacity of each ring buffer (must be a power of two).
+  static constexpr size_t kCapacity = 1UL << 17UL;
+
+  /*##########################################################################*
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  LatencyRing() : buf_{std::make_unique<LatencyRecord[]>(kCapacity)} {}
+
+  LatencyRing(const LatencyRing &) = delete;
+  LatencyRing(LatencyRing &&) = delete;
+
+  auto operator=(const LatencyRing &obj) -> LatencyRing & = delete;
+  auto operator=(LatencyRing &&) -> LatencyRing & = delete;
+
+  /*##########################################################################*
+   * Public destructors
+   *##########################################################################*/
+
+  ~LatencyRing() = default;
+
+  /*##########################################################################*
+   * Public APIs
+   *##########################################################################*/
+
+  /**
+   * @brief Push a new record (only a producer can call this function).
+   *
+   * @param rec A latency record.
+   */
+  void
+  Push(  //
+      const LatencyRecord &rec)
+  {
+    const auto tail = tail_.load(std::memory_order_relaxed);
+    if (tail - head_cache_ >= kCapacity) [[unlikely]] {
+      head_cache_ = head_.load(std::memory_order_acquire);
+      if (tail - head_cache_ >= kCapacity) {
+        dropped_.store(dropped_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        return;
+      }
+    }
+    buf_[tail & kMask] = rec;
+    tail_.store(tail + 1, std::memory_order_release);
+  }
+
+  /**
+   * @brief Pop records (only a consumer can call this function).
+   *
+   * @param out An output buffer.
+   * @param max_num The maximum number of records to be popped.
+   * @return The number of popped records.
+   */
+  auto
+  Pop(  //
+      LatencyRecord *out,
+      const size_t max_num)  //
+      -> size_t
+  {
+    const auto head = head_.load(std::memory_order_relaxed);
+    const auto tail = tail_.load(std::memory_order_acquire);
+    const auto num = (tail - head < max_num) ? tail - head : max_num;
+    for (size_t i = 0; i < num; ++i) {
+      out[i] = buf_[(head + i) & kMask];
+    }
+    head_.store(head + num, std::memory_order_release);
+    return num;
+  }
+
+  /**
+   * @return The number of dropped records.
+   */
+  [[nodiscard]] auto
+  GetDroppedNum() const  //
+      -> size_t
+  {
+    return dropped_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  /*##########################################################################*
+   * Internal constants
+   *##########################################################################*/
+
+  /// @brief A bit mask for computing positions in the buffer.
+  static constexpr size_t kMask = kCapacity - 1;
+
+  static_assert((kCapacity & kMask) == 0);
+
+  /*##########################################################################*
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief The position of the next push (written by the producer).
+  alignas(kCacheLineSize) std::atomic_size_t tail_{};
+
+  /// @brief A cached position of the consumer to avoid loading `head_`.
+  size_t head_cache_{};
+
+  /// @brief The number of dropped records.
+  std::atomic_size_t dropped_{};
+
+  /// @brief The position of the next pop (written by the consumer).
+  alignas(kCacheLineSize) std::atomic_size_t head_{};
+
+  /// @brief A buffer of records.
+  alignas(kCacheLineSize) std::unique_ptr<LatencyRecord[]> buf_{};
+};
+
+/**
+ * @brief A class for streaming every latency sample to a binary file.
+ *
+ * Each worker has its own ring buffer, and a background writer drains them
+ * into a large buffer and appends it to a file with sequential writes. The
+ * file starts with an 8-byte magic `CPPBLAT1` and a 4-byte little-endian
+ * record size, followed by `LatencyRecord` in the native byte order.
+ */
+class LatencyLog
+{
+ public:
+  /*##########################################################################*
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  /**
+   * @brief Open a new log file.
+   *
+   * @param path The path of an output log file.
+   * @note If the file cannot be opened, a warning is written to stderr and
+   * `IsOpen` returns false.
+   */
+  explicit LatencyLog(  //
+      const std::string &path);
+
+  LatencyLog(const LatencyLog &) = delete;
+  LatencyLog(LatencyLog &&) = delete;
+
+  auto operator=(const LatencyLog &obj) -> LatencyLog & = delete;
+  auto operator=(LatencyLog &&) -> LatencyLog & = delete;
+
+  /*##########################################################################*
+   * Public destructors
+   *##########################################################################*/
+
+  /**
+   * @brief Stop the background writer if running and close the log file.
+   *
+   */
+  ~LatencyLog();
+
+  /*##########################################################################*
+   * Public APIs
+   *##########################################################################*/
+
+  /**
+   * @retval true if the log file is writable.
+   * @retval false otherwise.
+   */
+  [[nodiscard]] auto
+  IsOpen() const  //
+      -> bool
+  {
+    return ofs_.is_open();
+  }
+
+  /**
+   * @brief Prepare ring buffers and start the background writer.
+   *
+   * @param thread_num The number of worker threads.
+   */
+  void Start(  //
+      size_t thread_num);
+
+  /**
+   * @param thread_id The ID of a worker thread.
+   * @return The ring buffer of a given worker.
+   */
+  [[nodiscard]] auto
+  GetRing(  //
+      const size_t thread_id)  //
+      -> LatencyRing *
+  {
+    return &rings_[thread_id];
+  }
+
+  /**
+   * @brief Drain all the ring buffers and stop the background writer.
+   *
+   * This function must be called after all the workers have finished.
+   */
+  void Stop();
+
+  /**
+   * @return The number of written records in the last run.
+   */
+  [[nodiscard]] constexpr auto
+  GetWrittenNum() const  //
+      -> size_t
+  {
+    return written_num_;
+  }
+
+  /**
+   * @return The number of dropped records in the last run.
+   */
+  [[nodiscard]] constexpr auto
+  GetDroppedNum() const  //
+      -> size_t
+  {
+    return dropped_num_;
+  }
+
+ private:
+  /*##########################################################################*
+   * Internal constants
+   *##########################################################################*/
+
+  /// @brief The number of records in a single write.
+  static constexpr size_t kBufferedNum = (1UL << 20UL) / sizeof(LatencyRecord);
+
+  /// @brief An interval for polling ring buffers when they are empty.
+  static constexpr auto kIdleInterval = std::chrono::microseconds{100};
+
+  /*##########################################################################*
+   * Internal utility functions
+   *##########################################################################*/
+
+  /**
+   * @brief Drain ring buffers until the benchmarker stops this writer.
+   *
+   */
+  void WriteRecords();
+
+  /**
+   * @brief Pop records from all the ring buffers and write them.
+   *
+   * @return The number of popped records.
+   */
+  auto Drain()  //
+      -> size_t;
+
+  /**
+   * @brief Write buffered records to the log file.
+   *
+   */
+  void FlushBuffer();
+
+  /*##########################################################################*
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief An output log file.
+  std::ofstream ofs_{};
+
+  /// @brief Ring buffers for each worker.
+  std::unique_ptr<LatencyRing[]> rings_{};
+
+  /// @brief The number of ring buffers.
+  size_t ring_num_{};
+
+  /// @brief A buffer for sequential writes.
+  std::unique_ptr<LatencyRecord[]> buf_{};
+
+  /// @brief The number of buffered records.
+  size_t buf_num_{};
+
+  /// @brief The number of written records in the current run.
+  size_t written_num_{};
+
+  /// @brief The number of dropped records in the current run.
+  size_t dropped_num_{};
+
+  /// @brief A flag for stopping the background writer.
+  std::atomic_bool is_running_{};
+
+  /// @brief A background writer thread.
+  std::thread writer_{};
+};
+
+}  // namespace dbgroup::benchmark::component
+
+#endif  // DBGROUP_BENCHMARK_COMPONENT_LATENCY_LOG_HPP_
@@ -18,10 +18,16 @@
 #define DBGROUP_BENCHMARK_COMPONENT_MEASUREMENTS_HPP_
 
 // C++ standard libraries
+#include <algorithm>
 #include <array>
+#include <bit>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <istream>
+#include <map>
+#include <optional>
+#include <ostream>
 #include <vector>
 
 namespace dbgroup::benchmark::component
@@ -39,6 +45,13 @@ namespace dbgroup::benchmark::component
 class SimpleDDSketch
 {
  public:
+  /*##########################################################################*
+   * Public constants
+   *##########################################################################*/
+
+  /// @brief The number of bins.
+  static constexpr size_t kBinNum = 2048;
+
   /*##########################################################################*
    * Public constructors and assignment operators
    *##########################################################################*/
@@ -77,6 +90,8 @@ class SimpleDDSketch
    * @brief Merge a given sketch into this.
    *
    * @param rhs A sketch to be merged.
+   * @note Operations that this sketch does not have are ignored, so `rhs`
+   * should not have more operations than this.
    */
   void operator+=(  //
       const SimpleDDSketch &rhs);
@@ -95,6 +110,16 @@ class SimpleDDSketch
     return total_exec_num_;
   }
 
+  /**
+   * @return The number of operation types.
+   */
+  [[nodiscard]] auto
+  GetOPsNum() const  //
+      -> size_t
+  {
+    return exec_nums_.size();
+  }
+
   /**
    * @return Total execution time.
    */
@@ -111,11 +136,43 @@ class SimpleDDSketch
    * @param ops_id The ID of a target operation.
    * @param cnt The number of executions for throughput.
    * @param lat A measured latency [ns].
+   * @note This function is defined in this header so that it can be inlined
+   * into measurement loops of workers.
    */
-  void Add(  //
-      size_t ops_id,
-      size_t cnt,
-      size_t lat);
+  void
+  Add(  //
+      const size_t ops_id,
+      const size_t cnt,
+      const size_t lat)
+  {
+    total_exec_num_ += cnt;
+    total_exec_time_nano_ += lat;
+
+    auto &min = min_[ops_id];
+    if (lat < min) [[unlikely]] {
+      min = lat;
+    }
+    auto &max = max_[ops_id];
+    if (lat > max) [[unlikely]] {
+      max = lat;
+    }
+
+    const auto pos = GetBinPos(lat);
+    if (++bins_[ops_id][pos] == 0) [[unlikely]] {
+      AddToSpill(ops_id, pos, kSpillUnit);
+    }
+    sums_[ops_id] += lat;
+
+    // accumulate power sums of deviations from the first sample
+    auto &[shift, s2, s3] = moments_[ops_id];
+    if (++exec_nums_[ops_id] == 1) [[unlikely]] {
+      shift = lat;
+    }
+    const auto d = static_cast<double>(static_cast<int64_t>(lat - shift));
+    const auto d2 = d * d;
+    s2 += d2;
+    s3 += d2 * d;
+  }
 
   /**
    * @param ops_id The ID of a target operation.
@@ -126,6 +183,75 @@ class SimpleDDSketch
       size_t ops_id) const        //
       -> bool;
 
+  /**
+   * @param ops_id The ID of a target operation.
+   * @return The number of executions of a target operation.
+   */
+  [[nodiscard]] auto GetExecNum(  //
+      size_t ops_id) const        //
+      -> size_t;
+
+  /**
+   * @param ops_id The ID of a target operation.
+   * @param pos The position of a bin.
+   * @return The number of latency samples in a given bin.
+   */
+  [[nodiscard]] auto GetBinCount(  //
+      size_t ops_id,
+      size_t pos) const  //
+      -> size_t;
+
+  /**
+   * @brief Compute the position of a bin that includes given latency.
+   *
+   * This function returns `ceil(log_gamma(lat))` without calling `std::log`:
+   * it estimates `log2(lat)` from the exponent and mantissa of a floating point
+   * value and then corrects the estimation by comparing with bin boundaries.
+   *
+   * @param lat Latency [ns].
+   * @return The position of a bin.
+   */
+  [[nodiscard]] static auto
+  GetBinPos(  //
+      const size_t lat)  //
+      -> size_t
+  {
+    constexpr uint64_t kMantissaMask = (1UL << 52UL) - 1;
+    constexpr uint64_t kOneBits = 1023UL << 52UL;
+    constexpr double kMantissaCoef = 0.3466;  // max error of log2(1 + f) is 0.005
+    if (lat <= 1) return 0;
+
+    const auto val = static_cast<double>(lat);
+    const auto bits = std::bit_cast<uint64_t>(val);
+    const auto frac = std::bit_cast<double>((bits & kMantissaMask) | kOneBits) - 1.0;
+    const auto log2 = static_cast<double>((bits >> 52UL) - 1023) + frac
+                      + kMantissaCoef * frac * (1.0 - frac);
+    auto pos = std::min(static_cast<size_t>(log2 * inv_log2_gamma_), kBinNum - 1);
+    while (pos < kBinNum - 1 && upper_bounds_[pos] < val) {
+      ++pos;
+    }
+    while (pos > 0 && upper_bounds_[pos - 1] >= val) {
+      --pos;
+    }
+    return pos;
+  }
+
+  /**
+   * @param pos The position of a bin.
+   * @return The representative latency of a given bin [ns].
+   */
+  [[nodiscard]] static auto GetBinValue(  //
+      size_t pos)                         //
+      -> size_t;
+
+  /**
+   * @param pos The position of a bin.
+   * @return The upper bound (inclusive) of latency in a given bin [ns].
+   */
+  [[nodiscard]] static auto GetBinUpperBound(  //
+      size_t pos)                              //
+      -> size_t;
+
   /**
    * @param ops_id The ID of a target operation.
    * @param q A target quantile value.
@@ -136,13 +262,111 @@ class SimpleDDSketch
       double q) const  //
       -> size_t;
 
+  /**
+   * @param ops_id The ID of a target operation.
+   * @return Total latency of a target operation [ns].
+   */
+  [[nodiscard]] auto GetTotalTime(  //
+      size_t ops_id) const          //
+      -> size_t;
+
+  /**
+   * @param ops_id The ID of a target operation.
+   * @return The mean latency of a target operation [ns].
+   */
+  [[nodiscard]] auto GetMean(  //
+      size_t ops_id) const     //
+      -> double;
+
+  /**
+   * @param ops_id The ID of a target operation.
+   * @return The unbiased sample variance of latency [ns^2].
+   */
+  [[nodiscard]] auto GetVariance(  //
+      size_t ops_id) const         //
+      -> double;
+
+  /**
+   * @param ops_id The ID of a target operation.
+   * @return The sample standard deviation of latency [ns].
+   */
+  [[nodiscard]] auto GetStdDev(  //
+      size_t ops_id) const       //
+      -> double;
+
+  /**
+   * @param ops_id The ID of a target operation.
+   * @return The sample skewness of latency.
+   */
+  [[nodiscard]] auto GetSkewness(  //
+      size_t ops_id) const         //
+      -> double;
+
+  /**
+   * @brief Write this sketch in a binary format.
+   *
+   * The format starts with an 8-byte magic `CPPBSKT1` and stores integers and
+   * floating point values in the native byte order. Only non-empty bins are
+   * written.
+   *
+   * @param os An output stream.
+   */
+  void Serialize(  //
+      std::ostream &os) const;
+
+  /**
+   * @brief Read a sketch written by `Serialize`.
+   *
+   * @param is An input stream.
+   * @return A sketch if it is successfully read.
+   */
+  [[nodiscard]] static auto Deserialize(  //
+      std::istream &is)                   //
+      -> std::optional<SimpleDDSketch>;
+
  private:
   /*##########################################################################*
-   * Internal constants
+   * Internal types
    *##########################################################################*/
 
-  /// @brief The number of bins.
-  static constexpr size_t kBinNum = 2048;
+  /**
+   * @brief Power sums of latency deviations from a shift value.
+   *
+   * `Add` only accumulates these sums without divisions, and central moments
+   * are derived from them when they are read. Deviations are taken from a
+   * sample (the first one by default) instead of zero, which avoids most of
+   * the cancellation of naive power sums. The sum of deviations themselves is
+   * derived from the integer sum of latency, so it is exact.
+   */
+  struct Moments {
+    /// @brief A shift value subtracted from each sample [ns].
+    size_t shift{};
+
+    /// @brief The sum of squared deviations from the shift.
+    double s2{};
+
+    /// @brief The sum of cubed deviations from the shift.
+    double s3{};
+  };
+
+  /**
+   * @brief Central moments of latency.
+   *
+   */
+  struct CentralMoments {
+    /// @brief The mean.
+    double mean{};
+
+    /// @brief The sum of squared deviations from the mean.
+    double m2{};
+
+    /// @brief The sum of cubed deviations from the mean.
+    double m3{};
+  };
+
+  /*##########################################################################*
+   * Internal constants
+   *##########################################################################*/
 
   /// @brief A desired relative error.
   static constexpr double kAlpha = 0.01;
@@ -150,8 +374,64 @@ class SimpleDDSketch
   /// @brief The base value for approximation.
   static constexpr double kGamma = (1.0 + kAlpha) / (1.0 - kAlpha);
 
-  /// @brief The denominator for the logarithm change of base.
-  static inline const double denom_ = std::log(kGamma);  // NOLINT
+  /// @brief The number of counts carried to spilled counters by an overflow.
+  static constexpr size_t kSpillUnit = 1UL << 32UL;
+
+  /// @brief The reciprocal of `log2(kGamma)` for computing bin positions.
+  static inline const double inv_log2_gamma_ = 1.0 / std::log2(kGamma);  // NOLINT
+
+  /// @brief The upper bound of each bin (i.e., `kGamma^pos`).
+  static inline const std::array<double, kBinNum> upper_bounds_ = [] {  // NOLINT
+    std::array<double, kBinNum> bounds{};
+    for (size_t pos = 0; pos < kBinNum; ++pos) {
+      bounds[pos] = std::pow(kGamma, pos);
+    }
+    return bounds;
+  }();
+
+  /*##########################################################################*
+   * Internal utility functions
+   *##########################################################################*/
+
+  /**
+   * @param ops_id The ID of a target operation.
+   * @return The sum of latency deviations from the shift of moments.
+   */
+  [[nodiscard]] auto GetShiftedSum(  //
+      size_t ops_id) const           //
+      -> double;
+
+  /**
+   * @param ops_id The ID of a target operation.
+   * @return Central moments derived from power sums.
+   */
+  [[nodiscard]] auto GetCentralMoments(  //
+      size_t ops_id) const               //
+      -> CentralMoments;
+
+  /**
+   * @brief Add counts that overflow compact bins.
+   *
+   * @param ops_id The ID of a target operation.
+   * @param pos The position of a bin.
+   * @param cnt The number of samples to be added.
+   */
+  void AddToSpill(  //
+      size_t ops_id,
+      size_t pos,
+      size_t cnt);
+
+  /**
+   * @brief Set the number of samples in a bin.
+   *
+   * @param ops_id The ID of a target operation.
+   * @param pos The position of a bin.
+   * @param cnt The number of samples.
+   */
+  void SetBinCount(  //
+      size_t ops_id,
+      size_t pos,
+      size_t cnt);
 
   /*##########################################################################*
    * Internal member variables
@@ -172,8 +452,17 @@ class SimpleDDSketch
   /// @brief The number of executions for each operations.
   std::vector<size_t> exec_nums_{};
 
-  /// @brief Execution time for each operation [ns].
+  /// @brief Total latency for each operation [ns].
+  std::vector<size_t> sums_{};
+
+  /// @brief Power sums of latency for each operation.
+  std::vector<Moments> moments_{};
+
+  /// @brief Lower 32 bits of the number of samples in each bin.
   std::vector<std::array<uint32_t, kBinNum>> bins_{};
+
+  /// @brief Upper bits of the number of samples only for overflowed bins.
+  std::vector<std::map<size_t, size_t>> spills_{};
 };
 
 }  // namespace dbgroup::benchmark::component
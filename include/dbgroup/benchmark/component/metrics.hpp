@@ -0,0 +1,302 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DBGROUP_BENCHMARK_COMPONENT_METRICS_HPP_
+#define DBGROUP_BENCHMARK_COMPONENT_METRICS_HPP_
+
+// C++ standard libraries
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// local sources
+#include "dbgroup/benchmark/component/measurements.hpp"
+
+namespace dbgroup::benchmark::component
+{
+/**
+ * @brief A set of target-defined metrics recorded by a single worker.
+ *
+ * Counters and histograms are identified by IDs given by `Metrics`, and each
+ * worker owns its registry, so updates need no synchronization. Histograms
+ * reuse latency sketches, so their values must be non-negative integers.
+ */
+class MetricsRegistry
+{
+ public:
+  /*##########################################################################*
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  /**
+   * @brief Create a registry for all the registered metrics.
+   *
+   */
+  MetricsRegistry();
+
+  MetricsRegistry(const MetricsRegistry &) = default;
+  MetricsRegistry(MetricsRegistry &&) = default;
+
+  auto operator=(const MetricsRegistry &obj) -> MetricsRegistry & = default;
+  auto operator=(MetricsRegistry &&) -> MetricsRegistry & = default;
+
+  /*##########################################################################*
+   * Public destructors
+   *##########################################################################*/
+
+  ~MetricsRegistry() = default;
+
+  /*##########################################################################*
+   * Public operators
+   *##########################################################################*/
+
+  /**
+   * @brief Merge metrics of another worker.
+   *
+   * If `rhs` has more histograms (i.e., they have been registered after this
+   * registry was created), this registry is extended to hold them.
+   *
+   * @param rhs Metrics to be merged.
+   * @return Oneself.
+   */
+  auto operator+=(  //
+      const MetricsRegistry &rhs)  //
+      -> MetricsRegistry &;
+
+  /*##########################################################################*
+   * Public APIs
+   *##########################################################################*/
+
+  /**
+   * @brief Add a given value to a counter.
+   *
+   * @param id The ID of a counter.
+   * @param delta A value to be added.
+   */
+  void
+  Increment(  //
+      const size_t id,
+      const uint64_t delta)
+  {
+    if (id < counters_.size()) [[likely]] {
+      counters_[id] += delta;
+    }
+  }
+
+  /**
+   * @brief Record a given value in a histogram.
+   *
+   * @param id The ID of a histogram.
+   * @param value A value to be recorded.
+   */
+  void
+  Record(  //
+      const size_t id,
+      const size_t value)
+  {
+    if (id < hist_num_) [[likely]] {
+      histograms_.Add(id, 1, value);
+    }
+  }
+
+  /**
+   * @param id The ID of a counter.
+   * @return The value of a given counter.
+   */
+  [[nodiscard]] auto
+  GetCounter(  //
+      const size_t id) const  //
+      -> uint64_t
+  {
+    return (id < counters_.size()) ? counters_[id] : 0;
+  }
+
+  /**
+   * @return Recorded histograms (each histogram uses its ID as an operation ID).
+   */
+  [[nodiscard]] constexpr auto
+  GetHistograms() const  //
+      -> const SimpleDDSketch &
+  {
+    return histograms_;
+  }
+
+  /**
+   * @retval true if no metrics are registered.
+   * @retval false otherwise.
+   */
+  [[nodiscard]] auto
+  IsEmpty() const  //
+      -> bool
+  {
+    return counters_.empty() && hist_num_ == 0;
+  }
+
+  /**
+   * @brief Output metrics with their names.
+   *
+   * In CSV format, this function also outputs a header line. In text format,
+   * each line shows a counter or the count and p50/p99/max of a histogram.
+   *
+   * @param os An output stream.
+   * @param as_csv A flag for outputting metrics as CSV.
+   */
+  void Report(  //
+      std::ostream &os,
+      bool as_csv) const;
+
+ private:
+  /*##########################################################################*
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief Counters.
+  std::vector<uint64_t> counters_{};
+
+  /// @brief The number of histograms.
+  size_t hist_num_{};
+
+  /// @brief Histograms.
+  SimpleDDSketch histograms_{};
+};
+
+/**
+ * @brief A utility class for registering and updating target-defined metrics.
+ *
+ * Targets register metrics by names before benchmarking and update them by the
+ * returned IDs. Each worker attaches its own registry to its thread during
+ * measurements, so updates from other threads (e.g., during warm-up or on
+ * fan-out helpers) are ignored.
+ */
+class Metrics
+{
+ public:
+  /*##########################################################################*
+   * Public APIs for registration
+   *##########################################################################*/
+
+  /**
+   * @param name The name of a counter.
+   * @return The ID of a counter (the same ID for the same name).
+   */
+  static auto RegisterCounter(  //
+      const std::string &name)  //
+      -> size_t;
+
+  /**
+   * @param name The name of a histogram.
+   * @return The ID of a histogram (the same ID for the same name).
+   */
+  static auto RegisterHistogram(  //
+      const std::string &name)  //
+      -> size_t;
+
+  /**
+   * @return The names of registered counters.
+   */
+  [[nodiscard]] static auto GetCounterNames()  //
+      -> std::vector<std::string>;
+
+  /**
+   * @return The names of registered histograms.
+   */
+  [[nodiscard]] static auto GetHistogramNames()  //
+      -> std::vector<std::string>;
+
+  /*##########################################################################*
+   * Public APIs for workers and targets
+   *##########################################################################*/
+
+  /**
+   * @brief Attach a registry to the current thread.
+   *
+   * @param registry A registry for recording metrics (null detaches it).
+   */
+  static void
+  Attach(  //
+      MetricsRegistry *registry)
+  {
+    local_ = registry;
+  }
+
+  /**
+   * @brief Add a given value to a counter of the current thread.
+   *
+   * @param id The ID of a counter.
+   * @param delta A value to be added.
+   */
+  static void
+  Increment(  //
+      const size_t id,
+      const uint64_t delta = 1)
+  {
+    if (local_ == nullptr) return;
+    local_->Increment(id, delta);
+  }
+
+  /**
+   * @brief Record a given value in a histogram of the current thread.
+   *
+   * @param id The ID of a histogram.
+   * @param value A value to be recorded.
+   */
+  static void
+  Record(  //
+      const size_t id,
+      const size_t value)
+  {
+    if (local_ == nullptr) return;
+    local_->Record(id, value);
+  }
+
+ private:
+  /*##########################################################################*
+   * Internal utility functions
+   *##########################################################################*/
+
+  /**
+   * @param names Registered names.
+   * @param name A name to be registered.
+   * @return The position of a given name.
+   */
+  static auto Register(  //
+      std::vector<std::string> &names,
+      const std::string &name)  //
+      -> size_t;
+
+  /*##########################################################################*
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief A mutex for registration.
+  static inline std::mutex mtx_{};
+
+  /// @brief The names of registered counters.
+  static inline std::vector<std::string> counter_names_{};
+
+  /// @brief The names of registered histograms.
+  static inline std::vector<std::string> hist_names_{};
+
+  /// @brief A registry attached to the current thread.
+  static inline thread_local MetricsRegistry *local_{nullptr};
+};
+
+}  // namespace dbgroup::benchmark::component
+
+#endif  // DBGROUP_BENCHMARK_COMPONENT_METRICS_HPP_
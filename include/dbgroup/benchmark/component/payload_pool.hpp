@@ -0,0 +1,113 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DBGROUP_BENCHMARK_COMPONENT_PAYLOAD_POOL_HPP_
+#define DBGROUP_BENCHMARK_COMPONENT_PAYLOAD_POOL_HPP_
+
+// C++ standard libraries
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <span>
+
+namespace dbgroup::benchmark::component
+{
+/**
+ * @brief A pre-allocated pool of payload bytes shared by workers.
+ *
+ * An operation engine can pass `std::span` views of this pool as operation
+ * arguments (e.g., values to be written), so workers do not copy or allocate
+ * payloads for each operation. The pool is filled with pseudo-random bytes
+ * once and never modified, so concurrent reads need no synchronization.
+ */
+class PayloadPool
+{
+ public:
+  /*##########################################################################*
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  /**
+   * @brief Allocate a new pool and fill it with pseudo-random bytes.
+   *
+   * @param size The number of bytes in the pool.
+   * @param rand_seed A random seed for payload bytes.
+   */
+  explicit PayloadPool(  //
+      size_t size,
+      size_t rand_seed = 0);
+
+  PayloadPool(const PayloadPool &) = delete;
+  PayloadPool(PayloadPool &&) = default;
+
+  auto operator=(const PayloadPool &obj) -> PayloadPool & = delete;
+  auto operator=(PayloadPool &&) -> PayloadPool & = default;
+
+  /*##########################################################################*
+   * Public destructors
+   *##########################################################################*/
+
+  ~PayloadPool() = default;
+
+  /*##########################################################################*
+   * Public APIs
+   *##########################################################################*/
+
+  /**
+   * @return The number of bytes in the pool.
+   */
+  [[nodiscard]] constexpr auto
+  GetSize() const  //
+      -> size_t
+  {
+    return size_;
+  }
+
+  /**
+   * @brief Get a view of payload bytes.
+   *
+   * @param pos An arbitrary position (e.g., a random value or a key), which
+   * is wrapped so that a returned view fits in the pool.
+   * @param len The length of a payload.
+   * @return A view of payload bytes.
+   * @note If `len` exceeds the pool size, a returned view is truncated to the
+   * whole pool instead of running past its end.
+   */
+  [[nodiscard]] auto
+  Get(  //
+      const size_t pos,
+      const size_t len) const  //
+      -> std::span<const std::byte>
+  {
+    const auto n = std::min(len, size_);
+    return {buf_.get() + pos % (size_ - n + 1), n};
+  }
+
+ private:
+  /*##########################################################################*
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief Payload bytes.
+  std::unique_ptr<std::byte[]> buf_{};
+
+  /// @brief The number of bytes in the pool.
+  size_t size_{};
+};
+
+}  // namespace dbgroup::benchmark::component
+
+#endif  // DBGROUP_BENCHMARK_COMPONENT_PAYLOAD_POOL_HPP_
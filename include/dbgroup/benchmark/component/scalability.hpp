@@ -0,0 +1,153 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DBGROUP_BENCHMARK_COMPONENT_SCALABILITY_HPP_
+#define DBGROUP_BENCHMARK_COMPONENT_SCALABILITY_HPP_
+
+// C++ standard libraries
+#include <cstddef>
+#include <vector>
+
+namespace dbgroup::benchmark::component
+{
+/**
+ * @brief A class for fitting scalability models to measured throughput.
+ *
+ * This class fits Amdahl's law or the Universal Scalability Law (USL) [1]:
+ *
+ *   X(N) = lambda * N / (1 + sigma * (N - 1) + kappa * N * (N - 1)),
+ *
+ * where `sigma` and `kappa` denote contention and coherency coefficients,
+ * respectively. Amdahl's law is the special case of `kappa = 0`. Since the
+ * model can be linearized as `N / X(N) = a + b * (N - 1) + c * N * (N - 1)`,
+ * this class uses the ordinary least squares method for fitting.
+ *
+ * [1] Neil J. Gunther, "Guerrilla Capacity Planning," Springer, 2007.
+ */
+class ScalabilityModel
+{
+ public:
+  /*##########################################################################*
+   * Public types
+   *##########################################################################*/
+
+  /**
+   * @brief Supported scalability models.
+   *
+   */
+  enum Type {
+    kAmdahl = 0,
+    kUSL,
+  };
+
+  /*##########################################################################*
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  /**
+   * @brief Fit a new scalability model to measured throughput.
+   *
+   * @param type A model to be fitted.
+   * @param thread_nums The numbers of threads used for measurements.
+   * @param throughputs Measured throughput for each number of threads.
+   * @note If there are not enough measurements or the fitted coefficients are
+   * negative, this model is reduced to a simpler one (e.g., the USL with
+   * `kappa = 0`).
+   */
+  ScalabilityModel(  //
+      Type type,
+      const std::vector<size_t> &thread_nums,
+      const std::vector<double> &throughputs);
+
+  ScalabilityModel(const ScalabilityModel &) = default;
+  ScalabilityModel(ScalabilityModel &&) = default;
+
+  auto operator=(const ScalabilityModel &obj) -> ScalabilityModel & = default;
+  auto operator=(ScalabilityModel &&) -> ScalabilityModel & = default;
+
+  /*##########################################################################*
+   * Public destructors
+   *##########################################################################*/
+
+  ~ScalabilityModel() = default;
+
+  /*##########################################################################*
+   * Public APIs
+   *##########################################################################*/
+
+  /**
+   * @return Throughput of a single thread.
+   */
+  [[nodiscard]] constexpr auto
+  GetLambda() const  //
+      -> double
+  {
+    return lambda_;
+  }
+
+  /**
+   * @return The contention (serialization) coefficient.
+   */
+  [[nodiscard]] constexpr auto
+  GetContention() const  //
+      -> double
+  {
+    return sigma_;
+  }
+
+  /**
+   * @return The coherency (crosstalk) coefficient.
+   */
+  [[nodiscard]] constexpr auto
+  GetCoherency() const  //
+      -> double
+  {
+    return kappa_;
+  }
+
+  /**
+   * @param thread_num The number of threads.
+   * @return Predicted throughput.
+   */
+  [[nodiscard]] auto Predict(  //
+      size_t thread_num) const  //
+      -> double;
+
+  /**
+   * @return The number of threads that maximizes throughput (zero if this
+   * model predicts throughput increases monotonically).
+   */
+  [[nodiscard]] auto GetPeakThreadNum() const  //
+      -> size_t;
+
+ private:
+  /*##########################################################################*
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief Throughput of a single thread.
+  double lambda_{};
+
+  /// @brief The contention coefficient.
+  double sigma_{};
+
+  /// @brief The coherency coefficient.
+  double kappa_{};
+};
+
+}  // namespace dbgroup::benchmark::component
+
+#endif  // DBGROUP_BENCHMARK_COMPONENT_SCALABILITY_HPP_
@@ -0,0 +1,108 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DBGROUP_BENCHMARK_COMPONENT_SIGNAL_HANDLER_HPP_
+#define DBGROUP_BENCHMARK_COMPONENT_SIGNAL_HANDLER_HPP_
+
+// C++ standard libraries
+#include <atomic>
+
+namespace dbgroup::benchmark::component
+{
+/**
+ * @brief A class for catching SIGINT/SIGTERM during benchmarking.
+ *
+ * An instance of this class replaces the handlers of SIGINT and SIGTERM while
+ * it is alive, and the benchmarker polls `IsInterrupted` to stop workers
+ * gracefully. If a signal is received twice, the default handler terminates
+ * the process as usual.
+ */
+class SignalHandler
+{
+ public:
+  /*##########################################################################*
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  /**
+   * @brief Install signal handlers and reset the interruption flag.
+   *
+   */
+  SignalHandler();
+
+  SignalHandler(const SignalHandler &) = delete;
+  SignalHandler(SignalHandler &&) = delete;
+
+  auto operator=(const SignalHandler &obj) -> SignalHandler & = delete;
+  auto operator=(SignalHandler &&) -> SignalHandler & = delete;
+
+  /*##########################################################################*
+   * Public destructors
+   *##########################################################################*/
+
+  /**
+   * @brief Restore the previous signal handlers.
+   *
+   */
+  ~SignalHandler();
+
+  /*##########################################################################*
+   * Public APIs
+   *##########################################################################*/
+
+  /**
+   * @retval true if SIGINT or SIGTERM has been received.
+   * @retval false otherwise.
+   */
+  [[nodiscard]] static auto IsInterrupted()  //
+      -> bool;
+
+ private:
+  /*##########################################################################*
+   * Type aliases
+   *##########################################################################*/
+
+  using Handler_t = void (*)(int);
+
+  /*##########################################################################*
+   * Internal utility functions
+   *##########################################################################*/
+
+  /**
+   * @brief Set the interruption flag or terminate the process if already set.
+   *
+   * @param sig A received signal.
+   */
+  static void HandleSignal(  //
+      int sig);
+
+  /*##########################################################################*
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief A flag for indicating a signal has been received.
+  static inline std::atomic_bool interrupted_{false};
+
+  /// @brief The previous handler of SIGINT.
+  Handler_t old_int_handler_{};
+
+  /// @brief The previous handler of SIGTERM.
+  Handler_t old_term_handler_{};
+};
+
+}  // namespace dbgroup::benchmark::component
+
+#endif  // DBGROUP_BENCHMARK_COMPONENT_SIGNAL_HANDLER_HPP_
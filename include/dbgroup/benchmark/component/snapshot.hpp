@@ -0,0 +1,288 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DBGROUP_BENCHMARK_COMPONENT_SNAPSHOT_HPP_
+#define DBGROUP_BENCHMARK_COMPONENT_SNAPSHOT_HPP_
+
+// C++ standard libraries
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// local sources
+#include "dbgroup/benchmark/component/common.hpp"
+#include "dbgroup/benchmark/component/measurements.hpp"
+
+namespace dbgroup::benchmark::component
+{
+/**
+ * @brief A double-buffered sketch for reading a worker's latency while the
+ * worker keeps recording it.
+ *
+ * A worker records latency into an active buffer. When a reporter requests a
+ * new epoch, the worker copies the active buffer into the other one, switches
+ * buffers, and acknowledges the epoch. The retired buffer is then a consistent
+ * snapshot that the worker never touches until the next request, so neither
+ * side uses atomic read-modify-write operations.
+ */
+class SnapshotSketch
+{
+ public:
+  /*##########################################################################*
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  /**
+   * @brief Create a new SnapshotSketch object.
+   *
+   * @param ops_num The number of operation types.
+   */
+  explicit SnapshotSketch(  //
+      size_t ops_num);
+
+  SnapshotSketch(const SnapshotSketch &) = delete;
+  SnapshotSketch(SnapshotSketch &&) = delete;
+
+  auto operator=(const SnapshotSketch &obj) -> SnapshotSketch & = delete;
+  auto operator=(SnapshotSketch &&) -> SnapshotSketch & = delete;
+
+  /*##########################################################################*
+   * Public destructors
+   *##########################################################################*/
+
+  ~SnapshotSketch() = default;
+
+  /*##########################################################################*
+   * Public APIs for a worker
+   *##########################################################################*/
+
+  /**
+   * @return The buffer for recording latency.
+   */
+  [[nodiscard]] auto
+  GetActive()  //
+      -> SimpleDDSketch &
+  {
+    return bufs_[active_];
+  }
+
+  /**
+   * @retval true if a reporter requests a new snapshot.
+   * @retval false otherwise.
+   */
+  [[nodiscard]] auto
+  IsRequested() const  //
+      -> bool
+  {
+    return requested_.load(std::memory_order_acquire) != epoch_;
+  }
+
+  /**
+   * @brief Publish the active buffer as a snapshot and switch buffers.
+   *
+   * @return The new buffer for recording latency.
+   */
+  auto Publish()  //
+      -> SimpleDDSketch &;
+
+  /**
+   * @brief Stop publishing snapshots and take recorded latency.
+   *
+   * @return Recorded latency.
+   */
+  auto Finish()  //
+      -> SimpleDDSketch;
+
+  /**
+   * @brief Resume publishing snapshots after `Finish` for a new worker.
+   *
+   * @param base Latency taken from this sketch so far, which is added to
+   * subsequent snapshots so that they remain cumulative.
+   */
+  void Restart(  //
+      const SimpleDDSketch &base);
+
+  /*##########################################################################*
+   * Public APIs for a reporter
+   *##########################################################################*/
+
+  /**
+   * @brief Request a worker to publish a snapshot.
+   *
+   * @param epoch A new epoch (must be larger than previous ones).
+   */
+  void
+  Request(  //
+      const uint64_t epoch)
+  {
+    requested_.store(epoch, std::memory_order_release);
+  }
+
+  /**
+   * @param epoch A requested epoch.
+   * @return A published snapshot if a worker has acknowledged a given epoch.
+   * @note A snapshot is valid until the reporter requests the next epoch.
+   */
+  [[nodiscard]] auto
+  GetSnapshot(  //
+      const uint64_t epoch) const  //
+      -> const SimpleDDSketch *
+  {
+    if (acked_.load(std::memory_order_acquire) != epoch) return nullptr;
+    return &bufs_[retired_];
+  }
+
+  /**
+   * @retval true if a worker has finished recording.
+   * @retval false otherwise.
+   */
+  [[nodiscard]] auto
+  IsFinished() const  //
+      -> bool
+  {
+    return is_finished_.load(std::memory_order_acquire);
+  }
+
+ private:
+  /*##########################################################################*
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief Double buffers.
+  SimpleDDSketch bufs_[2];  // NOLINT
+
+  /// @brief The position of the active buffer (only used by a worker).
+  size_t active_{0};
+
+  /// @brief The last acknowledged epoch (only used by a worker).
+  uint64_t epoch_{0};
+
+  /// @brief The position of the retired buffer (published by `acked_`).
+  size_t retired_{1};
+
+  /// @brief Latency taken by previous workers (only used by a worker).
+  SimpleDDSketch base_{};
+
+  /// @brief A flag for indicating `base_` is not empty.
+  bool has_base_{false};
+
+  /// @brief An epoch requested by a reporter.
+  alignas(kCacheLineSize) std::atomic_uint64_t requested_{0};
+
+  /// @brief An epoch acknowledged by a worker.
+  alignas(kCacheLineSize) std::atomic_uint64_t acked_{0};
+
+  /// @brief A flag for indicating a worker has finished.
+  std::atomic_bool is_finished_{false};
+};
+
+/**
+ * @brief A class for collecting snapshots of worker sketches into live
+ * aggregates.
+ *
+ * This class keeps the latest snapshot of each worker and merges them into a
+ * single sketch. If a worker does not respond to a request in time (e.g., it is
+ * blocked in a long operation), its previous snapshot is used instead.
+ */
+class SnapshotCollector
+{
+ public:
+  /*##########################################################################*
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  SnapshotCollector() = default;
+
+  SnapshotCollector(const SnapshotCollector &) = delete;
+  SnapshotCollector(SnapshotCollector &&) = delete;
+
+  auto operator=(const SnapshotCollector &obj) -> SnapshotCollector & = delete;
+  auto operator=(SnapshotCollector &&) -> SnapshotCollector & = delete;
+
+  /*##########################################################################*
+   * Public destructors
+   *##########################################################################*/
+
+  ~SnapshotCollector() = default;
+
+  /*##########################################################################*
+   * Public APIs
+   *##########################################################################*/
+
+  /**
+   * @brief Prepare sketches for workers.
+   *
+   * @param thread_num The number of worker threads.
+   * @param ops_num The number of operation types.
+   */
+  void Start(  //
+      size_t thread_num,
+      size_t ops_num);
+
+  /**
+   * @param thread_id The ID of a worker thread.
+   * @return The sketch of a given worker.
+   */
+  [[nodiscard]] auto
+  GetSketch(  //
+      const size_t thread_id)  //
+      -> SnapshotSketch *
+  {
+    return sketches_[thread_id].get();
+  }
+
+  /**
+   * @brief Take snapshots of all the workers and merge them.
+   *
+   * @return Live aggregates of workers' latency.
+   */
+  auto Collect()  //
+      -> const SimpleDDSketch &;
+
+ private:
+  /*##########################################################################*
+   * Internal constants
+   *##########################################################################*/
+
+  /// @brief The maximum time for waiting workers' responses.
+  static constexpr auto kMaxWait = std::chrono::milliseconds{10};
+
+  /*##########################################################################*
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief Sketches of workers.
+  std::vector<std::unique_ptr<SnapshotSketch>> sketches_{};
+
+  /// @brief The latest snapshots of workers.
+  std::vector<SimpleDDSketch> latest_{};
+
+  /// @brief Live aggregates of workers' latency.
+  SimpleDDSketch total_{};
+
+  /// @brief The number of operation types.
+  size_t ops_num_{};
+
+  /// @brief The last requested epoch.
+  uint64_t epoch_{0};
+};
+
+}  // namespace dbgroup::benchmark::component
+
+#endif  // DBGROUP_BENCHMARK_COMPONENT_SNAPSHOT_HPP_
@@ -0,0 +1,399 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DBGROUP_BENCHMARK_COMPONENT_SOAK_RECORDER_HPP_
+#define DBGROUP_BENCHMARK_COMPONENT_SOAK_RECORDER_HPP_
+
+// C++ standard libraries
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+// local sources
+#include "dbgroup/benchmark/component/hdr_histogram.hpp"
+#include "dbgroup/benchmark/component/heatmap.hpp"
+#include "dbgroup/benchmark/component/measurements.hpp"
+
+namespace dbgroup::benchmark::component
+{
+/**
+ * @brief A class for fitting a linear trend to a time series.
+ *
+ * This class only holds running sums, so its memory usage is constant
+ * regardless of the number of samples.
+ */
+class LinearTrend
+{
+ public:
+  /*##########################################################################*
+   * Public APIs
+   *##########################################################################*/
+
+  /**
+   * @brief Add a new sample.
+   *
+   * @param x An explanatory variable (e.g., a window ID).
+   * @param y An objective variable.
+   */
+  void Add(  //
+      double x,
+      double y);
+
+  /**
+   * @return The number of samples.
+   */
+  [[nodiscard]] constexpr auto
+  GetSampleNum() const  //
+      -> size_t
+  {
+    return n_;
+  }
+
+  /**
+   * @return The slope of the fitted line (zero if not determined).
+   */
+  [[nodiscard]] auto GetSlope() const  //
+      -> double;
+
+  /**
+   * @param x An explanatory variable.
+   * @return A fitted value.
+   */
+  [[nodiscard]] auto Predict(  //
+      double x) const  //
+      -> double;
+
+ private:
+  /*##########################################################################*
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief The number of samples.
+  size_t n_{};
+
+  /// @brief The sum of explanatory variables.
+  double sum_x_{};
+
+  /// @brief The sum of objective variables.
+  double sum_y_{};
+
+  /// @brief The sum of squared explanatory variables.
+  double sum_xx_{};
+
+  /// @brief The sum of products of explanatory and objective variables.
+  double sum_xy_{};
+};
+
+/**
+ * @brief A class for recording rolling windows of long-running benchmarks.
+ *
+ * Each worker hands over its sketch every fixed window, and a background
+ * thread merges sketches of the same window, appends a summary of the window
+ * to a log file, and discards it. This class only keeps windows that some
+ * workers have not finished yet, so its memory usage does not grow with the
+ * length of benchmarks. The drift of throughput, tail latency, and resident
+ * set size (RSS) over the whole run is tracked by linear trends, and
+ * per-window throughput for stability reports is kept as a bounded sample.
+ *
+ * The log file is CSV with the following columns:
+ * `window,elapsed_sec,throughput,rss_bytes,ops_id,exec_num,p50,p99,p999,max`.
+ */
+class SoakRecorder
+{
+ public:
+  /*##########################################################################*
+   * Public constants
+   *##########################################################################*/
+
+  /// @brief A quantile for tracking the drift of tail latency.
+  static constexpr double kTrendQuantile = 0.99;
+
+  /// @brief The maximum number of per-window throughputs kept for stability.
+  static constexpr size_t kMaxThroughputSampleNum = 1UL << 16UL;
+
+  /*##########################################################################*
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  /**
+   * @brief Construct a new recorder and start its background writer.
+   *
+   * @param thread_num The number of worker threads.
+   * @param ops_num The number of operation types.
+   * @param window_nano The length of each window [ns].
+   * @param log_path The path of an output log file (an empty string disables
+   * logging).
+   * @param hdr_log A writer of HdrHistogram interval logs if needed.
+   * @param heatmap A writer of latency-over-time heatmaps if needed.
+   */
+  SoakRecorder(  //
+      size_t thread_num,
+      size_t ops_num,
+      size_t window_nano,
+      const std::string &log_path,
+      HdrLogWriter *hdr_log = nullptr,
+      HeatmapWriter *heatmap = nullptr);
+
+  SoakRecorder(const SoakRecorder &) = delete;
+  SoakRecorder(SoakRecorder &&) = delete;
+
+  auto operator=(const SoakRecorder &obj) -> SoakRecorder & = delete;
+  auto operator=(SoakRecorder &&) -> SoakRecorder & = delete;
+
+  /*##########################################################################*
+   * Public destructors
+   *##########################################################################*/
+
+  /**
+   * @brief Flush remaining windows and stop the background writer.
+   *
+   */
+  ~SoakRecorder();
+
+  /*##########################################################################*
+   * Public APIs
+   *##########################################################################*/
+
+  /**
+   * @return The length of each window [ns].
+   */
+  [[nodiscard]] constexpr auto
+  GetWindow() const  //
+      -> size_t
+  {
+    return window_nano_;
+  }
+
+  /**
+   * @brief Hand over the sketch of a finished window.
+   *
+   * A worker must submit its windows in time order. Skipping windows is
+   * allowed (e.g., if an operation takes longer than a window), and skipped
+   * windows are regarded as empty ones for the worker.
+   *
+   * @param thread_id The ID of a submitting worker.
+   * @param window_id The ID of a finished window.
+   * @param sketch Measured latency in the window.
+   */
+  void Submit(  //
+      size_t thread_id,
+      size_t window_id,
+      SimpleDDSketch &&sketch);
+
+  /**
+   * @brief Flush all the remaining windows and stop the background writer.
+   *
+   * @param elapsed_nano Elapsed time from the beginning of the first window
+   * [ns], which is used for the length of the last (partial) window.
+   */
+  void Finish(  //
+      size_t elapsed_nano);
+
+  /**
+   * @return The number of flushed windows.
+   * @note This function must be called after `Finish`.
+   */
+  [[nodiscard]] constexpr auto
+  GetWindowNum() const  //
+      -> size_t
+  {
+    return next_window_;
+  }
+
+  /**
+   * @return Measured latency over the whole run.
+   * @note This function must be called after `Finish`.
+   */
+  [[nodiscard]] constexpr auto
+  GetTotalSketch() const  //
+      -> const SimpleDDSketch &
+  {
+    return total_;
+  }
+
+  /**
+   * @return The trend of per-window throughput [OPS/s].
+   */
+  [[nodiscard]] constexpr auto
+  GetThroughputTrend() const  //
+      -> const LinearTrend &
+  {
+    return throughput_trend_;
+  }
+
+  /**
+   * @return The number of full-length windows.
+   */
+  [[nodiscard]] constexpr auto
+  GetFullWindowNum() const  //
+      -> size_t
+  {
+    return full_window_num_;
+  }
+
+  /**
+   * @return Throughput of full-length windows [OPS/s].
+   * @note If there are more than `kMaxThroughputSampleNum` windows, this
+   * returns a uniform random sample of them (i.e., reservoir sampling) so
+   * that memory usage does not grow with the length of benchmarks.
+   */
+  [[nodiscard]] constexpr auto
+  GetWindowThroughputs() const  //
+      -> const std::vector<double> &
+  {
+    return throughputs_;
+  }
+
+  /**
+   * @return The trend of RSS [bytes].
+   */
+  [[nodiscard]] constexpr auto
+  GetRSSTrend() const  //
+      -> const LinearTrend &
+  {
+    return rss_trend_;
+  }
+
+  /**
+   * @param ops_id The ID of a target operation.
+   * @return The trend of per-window tail latency [ns].
+   */
+  [[nodiscard]] auto
+  GetLatencyTrend(  //
+      const size_t ops_id) const  //
+      -> const LinearTrend &
+  {
+    return latency_trends_.at(ops_id);
+  }
+
+ private:
+  /*##########################################################################*
+   * Internal types
+   *##########################################################################*/
+
+  /**
+   * @brief A sketch handed over by a worker.
+   *
+   */
+  struct Entry {
+    /// @brief The ID of a submitting worker.
+    size_t thread_id{};
+
+    /// @brief The ID of a finished window.
+    size_t window_id{};
+
+    /// @brief Measured latency in the window.
+    SimpleDDSketch sketch{};
+  };
+
+  /*##########################################################################*
+   * Internal utility functions
+   *##########################################################################*/
+
+  /**
+   * @brief Merge submitted sketches and flush finished windows.
+   *
+   */
+  void WriteWindows();
+
+  /**
+   * @brief Append a finished window to the log and update trends.
+   *
+   * @param sketch Merged latency in the window.
+   * @param window_nano The length of the window [ns].
+   */
+  void Flush(  //
+      const SimpleDDSketch &sketch,
+      size_t window_nano);
+
+  /*##########################################################################*
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief The number of operation types.
+  size_t ops_num_{};
+
+  /// @brief The length of each window [ns].
+  size_t window_nano_{};
+
+  /// @brief An output log file.
+  std::ofstream log_{};
+
+  /// @brief A writer of HdrHistogram interval logs.
+  HdrLogWriter *hdr_log_{};
+
+  /// @brief A writer of latency-over-time heatmaps.
+  HeatmapWriter *heatmap_{};
+
+  /// @brief A mutex for protecting submitted sketches.
+  std::mutex mtx_{};
+
+  /// @brief A condition variable for waking up the background writer.
+  std::condition_variable cond_{};
+
+  /// @brief Submitted sketches that have not been merged yet.
+  std::deque<Entry> queue_{};
+
+  /// @brief Elapsed time at the end of benchmarking (set by `Finish`).
+  size_t elapsed_nano_{};
+
+  /// @brief A flag for stopping the background writer.
+  bool finished_{false};
+
+  /// @brief The number of windows finished by each worker.
+  std::vector<size_t> finished_nums_{};
+
+  /// @brief Merged sketches of windows that some workers have not finished.
+  std::map<size_t, SimpleDDSketch> pending_{};
+
+  /// @brief The ID of the next window to be flushed.
+  size_t next_window_{};
+
+  /// @brief Measured latency over the whole run.
+  SimpleDDSketch total_{};
+
+  /// @brief The trend of per-window throughput.
+  LinearTrend throughput_trend_{};
+
+  /// @brief The number of full-length windows.
+  size_t full_window_num_{};
+
+  /// @brief Sampled throughput of full-length windows.
+  std::vector<double> throughputs_{};
+
+  /// @brief A random number generator for sampling windows.
+  std::mt19937_64 sampler_{};
+
+  /// @brief The trend of RSS.
+  LinearTrend rss_trend_{};
+
+  /// @brief The trends of per-window tail latency for each operation.
+  std::vector<LinearTrend> latency_trends_{};
+
+  /// @brief A background writer thread.
+  std::thread writer_{};
+};
+
+}  // namespace dbgroup::benchmark::component
+
+#endif  // DBGROUP_BENCHMARK_COMPONENT_SOAK_RECORDER_HPP_
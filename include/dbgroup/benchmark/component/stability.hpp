@@ -0,0 +1,180 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DBGROUP_BENCHMARK_COMPONENT_STABILITY_HPP_
+#define DBGROUP_BENCHMARK_COMPONENT_STABILITY_HPP_
+
+// C++ standard libraries
+#include <cstddef>
+#include <vector>
+
+namespace dbgroup::benchmark::component
+{
+/**
+ * @brief A class for summarizing the stability of per-window throughput.
+ *
+ * Mean throughput hides jitter, so this class summarizes throughput measured
+ * in fixed-size windows by its coefficient of variation (CV), the slowest and
+ * fastest windows, and the fraction of windows that fall below a given ratio
+ * of the median. Lower values of the CV and the fraction indicate more
+ * predictable performance.
+ */
+class ThroughputStability
+{
+ public:
+  /*##########################################################################*
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  /**
+   * @brief Summarize per-window throughput.
+   *
+   * @param throughputs Throughput of each window [OPS/s].
+   * @param threshold A ratio to the median for detecting slow windows.
+   */
+  ThroughputStability(  //
+      const std::vector<double> &throughputs,
+      double threshold);
+
+  ThroughputStability(const ThroughputStability &) = default;
+  ThroughputStability(ThroughputStability &&) = default;
+
+  auto operator=(const ThroughputStability &obj) -> ThroughputStability & = default;
+  auto operator=(ThroughputStability &&) -> ThroughputStability & = default;
+
+  /*##########################################################################*
+   * Public destructors
+   *##########################################################################*/
+
+  ~ThroughputStability() = default;
+
+  /*##########################################################################*
+   * Public APIs
+   *##########################################################################*/
+
+  /**
+   * @return The number of summarized windows.
+   */
+  [[nodiscard]] constexpr auto
+  GetWindowNum() const  //
+      -> size_t
+  {
+    return window_num_;
+  }
+
+  /**
+   * @return The mean of per-window throughput [OPS/s].
+   */
+  [[nodiscard]] constexpr auto
+  GetMean() const  //
+      -> double
+  {
+    return mean_;
+  }
+
+  /**
+   * @return The coefficient of variation of per-window throughput.
+   */
+  [[nodiscard]] constexpr auto
+  GetCV() const  //
+      -> double
+  {
+    return cv_;
+  }
+
+  /**
+   * @return The throughput of the slowest window [OPS/s].
+   */
+  [[nodiscard]] constexpr auto
+  GetMin() const  //
+      -> double
+  {
+    return min_;
+  }
+
+  /**
+   * @return The throughput of the fastest window [OPS/s].
+   */
+  [[nodiscard]] constexpr auto
+  GetMax() const  //
+      -> double
+  {
+    return max_;
+  }
+
+  /**
+   * @return The median of per-window throughput [OPS/s].
+   */
+  [[nodiscard]] constexpr auto
+  GetMedian() const  //
+      -> double
+  {
+    return median_;
+  }
+
+  /**
+   * @return A ratio to the median for detecting slow windows.
+   */
+  [[nodiscard]] constexpr auto
+  GetThreshold() const  //
+      -> double
+  {
+    return threshold_;
+  }
+
+  /**
+   * @return The fraction of windows below the threshold ratio of the median.
+   */
+  [[nodiscard]] constexpr auto
+  GetSlowFraction() const  //
+      -> double
+  {
+    return slow_fraction_;
+  }
+
+ private:
+  /*##########################################################################*
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief The number of summarized windows.
+  size_t window_num_{};
+
+  /// @brief The mean of per-window throughput.
+  double mean_{};
+
+  /// @brief The coefficient of variation.
+  double cv_{};
+
+  /// @brief The throughput of the slowest window.
+  double min_{};
+
+  /// @brief The throughput of the fastest window.
+  double max_{};
+
+  /// @brief The median of per-window throughput.
+  double median_{};
+
+  /// @brief A ratio to the median for detecting slow windows.
+  double threshold_{};
+
+  /// @brief The fraction of slow windows.
+  double slow_fraction_{};
+};
+
+}  // namespace dbgroup::benchmark::component
+
+#endif  // DBGROUP_BENCHMARK_COMPONENT_STABILITY_HPP_
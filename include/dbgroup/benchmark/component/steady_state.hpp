@@ -0,0 +1,64 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DBGROUP_BENCHMARK_COMPONENT_STEADY_STATE_HPP_
+#define DBGROUP_BENCHMARK_COMPONENT_STEADY_STATE_HPP_
+
+// C++ standard libraries
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace dbgroup::benchmark::component
+{
+/*############################################################################*
+ * Global constants
+ *############################################################################*/
+
+/// @brief The batch size of MSER-5.
+constexpr size_t kMSERBatchSize = 5;
+
+/// @brief The minimum number of batches remaining after truncation.
+constexpr size_t kMSERMinBatchNum = 4;
+
+/*############################################################################*
+ * Global utilities
+ *############################################################################*/
+
+/**
+ * @brief Detect the end of the initial transient by MSER-5 [1].
+ *
+ * This function divides a given series into batches of five samples and
+ * selects the truncation point that minimizes the marginal standard error of
+ * the remaining batch means. Following the usual rule, the series is regarded
+ * as being in steady state only if the truncation point is strictly in its
+ * first half. Since the truncation point cannot exceed the last
+ * `kMSERMinBatchNum` batches, this function requires at least twice as many
+ * batches so that the rule can reject non-stationary series.
+ *
+ * [1] K. Preston White, Jr. et al., "The MSER-5 algorithm for initial
+ * transient deletion," In Proc. WSC, pp. 1-8, 2010.
+ *
+ * @param series Per-interval throughput in time order.
+ * @return The number of samples to be truncated if steady state is detected.
+ */
+[[nodiscard]] auto DetectSteadyState(  //
+    const std::vector<double> &series)  //
+    -> std::optional<size_t>;
+
+}  // namespace dbgroup::benchmark::component
+
+#endif  // DBGROUP_BENCHMARK_COMPONENT_STEADY_STATE_HPP_
@@ -100,6 +100,16 @@ class StopWatch
     return std::chrono::duration_cast<std::chrono::nanoseconds>(end_time_ - start_time_).count();
   }
 
+  /**
+   * @return The timestamp when this stopwatch was stopped.
+   */
+  [[nodiscard]] constexpr auto
+  GetEndTime() const  //
+      -> Clock_t::time_point
+  {
+    return end_time_;
+  }
+
  private:
   /*##########################################################################*
    * Internal member variables
@@ -0,0 +1,152 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DBGROUP_BENCHMARK_COMPONENT_STRAGGLER_HPP_
+#define DBGROUP_BENCHMARK_COMPONENT_STRAGGLER_HPP_
+
+// C++ standard libraries
+#include <cstddef>
+#include <cstdint>
+
+namespace dbgroup::benchmark::component
+{
+/**
+ * @brief A model of periodic stalls of straggler workers.
+ *
+ */
+struct StallModel {
+  /*##########################################################################*
+   * Public types
+   *##########################################################################*/
+
+  /**
+   * @brief How a straggler stalls.
+   *
+   */
+  enum Type : uint8_t {
+    /// @brief Busy-wait on a CPU.
+    kSpin = 0,
+
+    /// @brief Sleep and release a CPU.
+    kSleep,
+
+    /// @brief Keep yielding a CPU to other threads.
+    kYield,
+  };
+
+  /**
+   * @brief Where a straggler stalls.
+   *
+   */
+  enum Position : uint8_t {
+    /// @brief Stall between operations.
+    kBetweenOPs = 0,
+
+    /// @brief Stall at the next `Straggler::StallPoint` called by a target
+    /// (e.g., while holding a lock).
+    kInCriticalSection,
+  };
+
+  /// @brief How a straggler stalls.
+  Type type{kSpin};
+
+  /// @brief Where a straggler stalls.
+  Position pos{kBetweenOPs};
+
+  /// @brief An interval between triggering stalls [ns] (zero disables stalls).
+  size_t period_nano{0};
+
+  /// @brief The length of each stall [ns].
+  size_t stall_nano{0};
+};
+
+/**
+ * @brief A utility class for injecting stalls into straggler workers.
+ *
+ */
+class Straggler
+{
+ public:
+  /*##########################################################################*
+   * Public APIs
+   *##########################################################################*/
+
+  /**
+   * @brief Stall the current thread now or at the next stall point.
+   *
+   * @param model A model of stalls.
+   */
+  static void
+  Trigger(  //
+      const StallModel &model)
+  {
+    if (model.pos == StallModel::kInCriticalSection) {
+      armed_ = &model;
+    } else {
+      Stall(model);
+    }
+  }
+
+  /**
+   * @brief Stall the current thread if a straggler worker has triggered it.
+   *
+   * Targets call this function where stalls should be injected (e.g., inside
+   * critical sections). The function only loads a thread-local pointer for
+   * non-straggler threads.
+   */
+  static void
+  StallPoint()
+  {
+    if (armed_ == nullptr) [[likely]] return;
+
+    const auto *model = armed_;
+    armed_ = nullptr;
+    Stall(*model);
+  }
+
+  /**
+   * @brief Stall the current thread for a given model.
+   *
+   * @param model A model of stalls.
+   */
+  static void Stall(  //
+      const StallModel &model);
+
+  /**
+   * @return The number of stalls executed in the current thread.
+   */
+  [[nodiscard]] static auto
+  GetStallNum()  //
+      -> size_t
+  {
+    return stall_num_;
+  }
+
+ private:
+  /*##########################################################################*
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief A stall waiting for the next stall point in this thread.
+  static inline thread_local const StallModel *armed_{nullptr};
+
+  /// @brief The number of stalls executed in this thread.
+  static inline thread_local size_t stall_num_{0};
+};
+
+}  // namespace dbgroup::benchmark::component
+
+#endif  // DBGROUP_BENCHMARK_COMPONENT_STRAGGLER_HPP_
@@ -18,16 +18,97 @@
 #define DBGROUP_BENCHMARK_COMPONENT_WORKER_HPP_
 
 // C++ standard libraries
+#include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <concepts>
 #include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <tuple>
+#include <type_traits>
 #include <utility>
+#include <variant>
+#include <vector>
 
 // local sources
+#include "dbgroup/benchmark/component/fan_out.hpp"
+#include "dbgroup/benchmark/component/latency_log.hpp"
 #include "dbgroup/benchmark/component/measurements.hpp"
+#include "dbgroup/benchmark/component/metrics.hpp"
+#include "dbgroup/benchmark/component/snapshot.hpp"
+#include "dbgroup/benchmark/component/soak_recorder.hpp"
 #include "dbgroup/benchmark/component/stopwatch.hpp"
+#include "dbgroup/benchmark/component/straggler.hpp"
 
 namespace dbgroup::benchmark::component
 {
+/**
+ * @brief A concept for operation engines that can classify operation arguments
+ * into key buckets (e.g., key ranges or page IDs).
+ *
+ * @tparam OperationEngine A class to generate operations.
+ */
+template <class OperationEngine>
+concept HasKeyBucket = requires(
+    const OperationEngine &engine,
+    const decltype((*std::declval<typename OperationEngine::OPIter &>()).second) &arg) {
+  { engine.GetKeyBucket(arg) } -> std::convertible_to<size_t>;
+};
+
+/**
+ * @brief A concept for targets that receive a worker ID in their preprocessing.
+ *
+ * A worker ID is deterministic for each run (see `Worker`), so targets can use
+ * it to derive per-thread state such as random seeds.
+ *
+ * @tparam Target A target implementation.
+ */
+template <class Target>
+concept HasWorkerID = requires(Target &target, const size_t worker_id) {
+  target.SetUpForWorker(worker_id);
+};
+
+/**
+ * @brief A trait for checking a given type is a specialization of `std::variant`.
+ *
+ * @tparam T A target type.
+ */
+template <class T>
+struct IsVariant : std::false_type {
+};
+
+template <class... Ts>
+struct IsVariant<std::variant<Ts...>> : std::true_type {
+};
+
+/**
+ * @brief A trait for checking a given type is a specialization of `std::tuple`.
+ *
+ * @tparam T A target type.
+ */
+template <class T>
+struct IsTuple : std::false_type {
+};
+
+template <class... Ts>
+struct IsTuple<std::tuple<Ts...>> : std::true_type {
+};
+
+/**
+ * @brief A concept for operation engines whose iterators yield each operation
+ * as a `std::variant` of operation structs.
+ *
+ * In this mode, a worker dispatches each operation to `Target::Execute(op)`
+ * overloaded for each operation struct, and the index of an alternative is
+ * used as its operation ID.
+ *
+ * @tparam OperationEngine A class to generate operations.
+ */
+template <class OperationEngine>
+concept HasVariantOPs = IsVariant<std::remove_cvref_t<
+    decltype(*std::declval<typename OperationEngine::OPIter &>())>>::value;
+
 /**
  * @brief A class of a worker thread for benchmarking.
  *
@@ -40,6 +121,14 @@ namespace dbgroup::benchmark::component
 template <class Target, class OperationEngine>
 class Worker
 {
+  /*##########################################################################*
+   * Type aliases
+   *##########################################################################*/
+
+  using Clock_t = ::std::chrono::high_resolution_clock;
+  using NanoSec = ::std::chrono::nanoseconds;
+  using OPs = std::remove_cvref_t<decltype(*std::declval<typename OperationEngine::OPIter &>())>;
+
  public:
   /*##########################################################################*
    * Public constructors/destructors
@@ -51,20 +140,62 @@ class Worker
    * @param target A referene to a target implementation.
    * @param operations Operation data to be performed by this worker.
    * @param is_running A flag for monitoring benchmarker's status.
+   * @param thread_id A unique thread ID.
+   * @param rand_seed A random seed.
+   * @param interval_nano An interval between operation arrivals [ns] (zero
+   * means a closed-loop benchmark).
+   * @param bucket_num The number of key buckets (zero disables per-key-bucket
+   * measurements).
+   * @param fan_out The number of sub-operations per logical operation (zero or
+   * one disables fan-out).
+   * @param use_helpers A flag for issuing sub-operations in parallel by helper
+   * threads (true) or serially by this worker (false).
+   * @param stall A model of periodic stalls if this worker is a straggler.
+   * @note This constructor calls `Target::SetUpForWorker` and measures its
+   * execution time (see `GetSetUpTime`). If a target accepts a worker ID (see
+   * `HasWorkerID`), this worker passes `thread_id * fan_out` and its helpers
+   * pass the following IDs, so every thread has a unique and deterministic ID.
    */
   Worker(  //
       Target &target,
       OperationEngine &ops_engine,
       const std::atomic_bool &is_running,
       const size_t thread_id,
-      const size_t rand_seed)
+      const size_t rand_seed,
+      const size_t interval_nano = 0,
+      const size_t bucket_num = 0,
+      const size_t fan_out = 1,
+      const bool use_helpers = false,
+      const StallModel *stall = nullptr)
       : target_{target},
         op_engine_{ops_engine},
         iter_{op_engine_.GetOPIter(thread_id, rand_seed)},
         is_running_{is_running},
-        sketch_{OperationEngine::OPType::kTotalNum}
+        thread_id_{thread_id},
+        interval_{interval_nano},
+        fan_out_{std::max(fan_out, 1UL)},
+        stall_{(stall != nullptr && stall->period_nano > 0) ? stall : nullptr},
+        sketch_{kOPsNum},
+        sub_sketch_{kOPsNum},
+        bucket_sketches_(bucket_num, SimpleDDSketch{kOPsNum})
   {
-    target_.SetUpForWorker();
+    StopWatch stopwatch{};
+    const auto worker_id = thread_id * fan_out_;
+    stopwatch.Start();
+    SetUpTarget(target_, worker_id);
+    stopwatch.Stop();
+    setup_nano_ = stopwatch.GetNanoDuration();
+
+    if (fan_out_ > 1 && use_helpers) {
+      auto &target_ref = target_;
+      helpers_ = std::make_unique<FanOutGroup<OPs>>(
+          fan_out_ - 1,
+          [&target_ref, worker_id](const size_t id) {
+            SetUpTarget(target_ref, worker_id + id + 1);
+          },
+          [&target_ref](const OPs &ops) { return MeasureSubOP(target_ref, ops); },
+          [&target_ref]() { target_ref.TearDownForWorker(); });
+    }
   }
 
   Worker(const Worker &) = delete;
@@ -80,13 +211,61 @@ class Worker
   /**
    * @brief Destroy the Worker object.
    *
+   * If `TearDown` has not been called, this destructor calls it.
    */
-  ~Worker() { target_.TearDownForWorker(); }
+  ~Worker() { TearDown(); }
 
   /*##########################################################################*
    * Public utility functions
    *##########################################################################*/
 
+  /**
+   * @brief Stop helper threads and call `Target::TearDownForWorker`.
+   *
+   * This function measures the execution time of the teardown hook (see
+   * `GetTearDownTime`) and does nothing if it has already been called.
+   */
+  void
+  TearDown()
+  {
+    if (is_torn_down_) return;
+    is_torn_down_ = true;
+    helpers_.reset();
+
+    StopWatch stopwatch{};
+    stopwatch.Start();
+    target_.TearDownForWorker();
+    stopwatch.Stop();
+    teardown_nano_ = stopwatch.GetNanoDuration();
+  }
+
+  /**
+   * @brief Execute operations without measurement until warm-up is finished.
+   *
+   * This worker publishes the number of executed operations every
+   * `kStopCheckInterval` operations so that the benchmarker can monitor
+   * per-interval throughput.
+   *
+   * @param is_warming_up A flag for indicating the warm-up phase.
+   * @param exec_cnt A counter for publishing the number of executions.
+   */
+  void
+  WarmUp(  //
+      const std::atomic_bool &is_warming_up,
+      std::atomic_size_t &exec_cnt)
+  {
+    for (size_t i = 1; iter_; ++iter_, ++i) [[likely]] {
+      Dispatch([&](const auto type, const auto &op) { Execute(target_, type, op); });
+      if ((i & kStopCheckMask) == 0) [[unlikely]] {
+        exec_cnt.store(i, kRelaxed);
+        if (!is_warming_up.load(std::memory_order_acquire)) return;
+      }
+    }
+    while (is_warming_up.load(std::memory_order_acquire)) {
+      // wait for the end of the warm-up phase
+    }
+  }
+
   /**
    * @brief Measure and store execution time for each operation.
    *
@@ -94,13 +273,156 @@ class Worker
   void
   Measure()
   {
-    for (; iter_ && is_running_.load(kRelaxed); ++iter_) [[likely]] {
-      const auto &[type, op] = *iter_;
-      stopwatch_.Start();
-      const auto cnt = target_.Execute(type, op);
-      stopwatch_.Stop();
-      sketch_.Add(type, cnt, stopwatch_.GetNanoDuration());
+    Measure(Clock_t::now(), Clock_t::time_point::max());
+  }
+
+  /**
+   * @brief Measure and store execution time for each operation in a given
+   * wall-clock interval.
+   *
+   * This worker stops itself when an operation finishes after the deadline, so
+   * the main thread does not need to interrupt workers. To avoid loading the
+   * shared stop flag for every operation, this worker checks it once every
+   * `kStopCheckInterval` operations.
+   *
+   * If an arrival interval is given, this worker issues operations in an
+   * open-loop manner. That is, each operation has its scheduled arrival time,
+   * and its latency includes the queueing delay from the scheduled time to
+   * avoid coordinated omission. An overloaded worker does not drain its backlog
+   * after the deadline, so all the workers share the same wall-clock window.
+   *
+   * If a recorder is given, this worker hands over its sketch to the recorder
+   * at the end of every window aligned to `start` (closed-loop only). The
+   * window boundary is checked together with the deadline, so this does not
+   * add any per-operation cost. The whole latency of this worker is also kept
+   * for `MoveSketch`.
+   *
+   * If a ring buffer is given, this worker also pushes a raw record of every
+   * operation to it.
+   *
+   * If a snapshot sketch is given, this worker records latency into it and
+   * publishes a snapshot when requested. The request is checked together with
+   * the stop flag, so this does not add any per-operation cost either.
+   *
+   * If fan-out is enabled, each logical operation consists of consecutive
+   * sub-operations from the operation iterator. The latency of a logical
+   * operation is the maximum of its sub-operations (i.e., the time to wait for
+   * all the shards if they were issued in parallel) and is recorded with the
+   * type of the first sub-operation, whereas sub-operations are recorded
+   * separately (see `MoveSubOPSketch`).
+   *
+   * If this worker is a straggler, it triggers a stall every period. Like
+   * window boundaries, the next stall is checked together with the deadline.
+   *
+   * Target-defined metrics are recorded in this worker's registry during this
+   * function (see `Metrics`).
+   *
+   * @param start A timestamp to start measuring.
+   * @param deadline A timestamp to stop measuring.
+   * @param recorder A recorder of rolling windows if needed.
+   * @param ring A ring buffer for raw latency logs if needed.
+   * @param live A sketch for live snapshots if needed.
+   */
+  void
+  Measure(  //
+      const Clock_t::time_point &start,
+      const Clock_t::time_point &deadline,
+      SoakRecorder *recorder = nullptr,
+      LatencyRing *ring = nullptr,
+      SnapshotSketch *live = nullptr)
+  {
+    auto now = Clock_t::now();
+    while (now < start) {
+      // wait for the other workers to start simultaneously
+      now = Clock_t::now();
     }
+    start_time_ = (now - start > kStartTolerance) ? now : start;
+    end_time_ = start_time_;
+    Metrics::Attach(&metrics_);
+    const auto stall_base = Straggler::GetStallNum();
+
+    auto *sketch = (live == nullptr) ? &sketch_ : &live->GetActive();
+    if (interval_.count() > 0) {
+      MeasureOpenLoop(deadline, ring, live, sketch);
+      if (live != nullptr) {
+        sketch_ = live->Finish();
+      }
+      stall_num_ += Straggler::GetStallNum() - stall_base;
+      Metrics::Attach(nullptr);
+      return;
+    }
+
+    // keep the whole latency of this worker separately from submitted windows
+    SimpleDDSketch submitted{(recorder == nullptr) ? 0 : kOPsNum};
+
+    size_t window_id = 0;
+    const NanoSec window{(recorder == nullptr) ? 0 : recorder->GetWindow()};
+    auto rec_end = (recorder == nullptr) ? deadline : std::min(deadline, start + window);
+    auto next_stall = GetNextStall();
+    auto window_end = std::min(rec_end, next_stall);
+    for (size_t i = 1; iter_; ++iter_, ++i) [[likely]] {
+      if (fan_out_ > 1) [[unlikely]] {
+        const auto [type, lat] = ExecuteFanOut();
+        sketch->Add(type, 1, lat);
+        if (ring != nullptr) {
+          ring->Push(MakeRecord(type, lat));
+        }
+        if (!iter_) break;
+      } else {
+        Dispatch([&](const auto type, const auto &op) {
+          stopwatch_.Start();
+          const auto cnt = Execute(target_, type, op);
+          stopwatch_.Stop();
+          const auto lat = stopwatch_.GetNanoDuration();
+          sketch->Add(type, cnt, lat);
+          end_time_ = stopwatch_.GetEndTime();
+          if (ring != nullptr) {
+            ring->Push(MakeRecord(type, lat));
+          }
+          AddToKeyBucket(type, op, cnt, lat);
+        });
+      }
+      if (end_time_ >= window_end) [[unlikely]] {
+        if (end_time_ >= deadline) break;
+        if (end_time_ >= next_stall) {
+          Straggler::Trigger(*stall_);
+          next_stall = GetNextStall();
+        }
+        if (recorder != nullptr && end_time_ >= rec_end) {
+          submitted += *sketch;
+          recorder->Submit(thread_id_, window_id, std::exchange(*sketch, SimpleDDSketch{kOPsNum}));
+          window_id = (end_time_ - start) / window;
+          rec_end = std::min(deadline, start + window * static_cast<NanoSec::rep>(window_id + 1));
+        }
+        window_end = std::min(rec_end, next_stall);
+      }
+      if ((i & kStopCheckMask) == 0) [[unlikely]] {
+        if (!is_running_.load(kRelaxed)) break;
+        if (live != nullptr && live->IsRequested()) {
+          sketch = &live->Publish();
+        }
+      }
+    }
+    if (recorder != nullptr) {
+      submitted += *sketch;
+      recorder->Submit(thread_id_, window_id, std::exchange(*sketch, SimpleDDSketch{kOPsNum}));
+      sketch_ = std::move(submitted);
+    }
+    if (live != nullptr) {
+      sketch_ = live->Finish();
+    }
+    stall_num_ += Straggler::GetStallNum() - stall_base;
+    Metrics::Attach(nullptr);
+  }
+
+  /**
+   * @return The wall-clock window that this worker actually measured [ns].
+   */
+  [[nodiscard]] auto
+  GetMeasuredWindow() const  //
+      -> size_t
+  {
+    return std::chrono::duration_cast<NanoSec>(end_time_ - start_time_).count();
   }
 
   /**
@@ -115,7 +437,399 @@ class Worker
     return std::move(sketch_);
   }
 
+  /**
+   * @return Execution time of `Target::SetUpForWorker` [ns].
+   */
+  [[nodiscard]] constexpr auto
+  GetSetUpTime() const  //
+      -> size_t
+  {
+    return setup_nano_;
+  }
+
+  /**
+   * @return Execution time of `Target::TearDownForWorker` [ns] (zero if
+   * `TearDown` has not been called).
+   */
+  [[nodiscard]] constexpr auto
+  GetTearDownTime() const  //
+      -> size_t
+  {
+    return teardown_nano_;
+  }
+
+  /**
+   * @return The number of stalls executed by this worker (including those in
+   * critical sections of a target).
+   */
+  [[nodiscard]] constexpr auto
+  GetStallNum() const  //
+      -> size_t
+  {
+    return stall_num_;
+  }
+
+  /**
+   * @brief Get measurement results of sub-operations with its ownership.
+   *
+   * @return Measurement results of sub-operations (empty if fan-out is
+   * disabled).
+   */
+  auto
+  MoveSubOPSketch()  //
+      -> SimpleDDSketch
+  {
+    return std::move(sub_sketch_);
+  }
+
+  /**
+   * @brief Get target-defined metrics with their ownership.
+   *
+   * @return Metrics recorded during measurements.
+   */
+  auto
+  MoveMetrics()  //
+      -> MetricsRegistry
+  {
+    return std::move(metrics_);
+  }
+
+  /**
+   * @brief Get per-key-bucket measurement results with their ownership.
+   *
+   * @return Measurement results for each key bucket.
+   */
+  auto
+  MoveKeyBucketSketches()  //
+      -> std::vector<SimpleDDSketch>
+  {
+    return std::move(bucket_sketches_);
+  }
+
  private:
+  /*##########################################################################*
+   * Internal utility functions
+   *##########################################################################*/
+
+  /**
+   * @brief Call a given function with the type and arguments of the current
+   * operation.
+   *
+   * If operations are variants, this function dispatches them by a switch on
+   * their indices generated at compile time, so a given function is
+   * instantiated for each operation struct and receives its ID as a constant.
+   *
+   * @tparam Func A function type.
+   * @param func A function called with `(type, op)`.
+   */
+  template <class Func>
+  void
+  Dispatch(  //
+      Func &&func)
+  {
+    Dispatch(*iter_, func);
+  }
+
+  /**
+   * @brief Call a given function with the type and arguments of an operation.
+   *
+   * @tparam Func A function type.
+   * @param ops An operation yielded by an operation iterator.
+   * @param func A function called with `(type, op)`.
+   */
+  template <class Func>
+  static void
+  Dispatch(  //
+      const OPs &ops,
+      Func &&func)
+  {
+    if constexpr (HasVariantOPs<OperationEngine>) {
+      DispatchVariant(ops, func, std::make_index_sequence<kOPsNum>{});
+    } else {
+      const auto &[type, op] = ops;
+      func(type, op);
+    }
+  }
+
+  /**
+   * @brief Call a given function with the active alternative of a variant.
+   *
+   * @tparam Variant A variant of operation structs.
+   * @tparam Func A function type.
+   * @tparam kIDs The IDs of operations.
+   * @param ops A variant holding the current operation.
+   * @param func A function called with `(type, op)`.
+   */
+  template <class Variant, class Func, size_t... kIDs>
+  static void
+  DispatchVariant(  //
+      const Variant &ops,
+      Func &func,
+      std::index_sequence<kIDs...>)
+  {
+    const auto id = ops.index();
+    [[maybe_unused]] const auto called =
+        ((id == kIDs && (func(std::integral_constant<size_t, kIDs>{}, *std::get_if<kIDs>(&ops)),
+                         true))
+         || ...);
+  }
+
+  /**
+   * @brief Execute a given operation in a target.
+   *
+   * If operation arguments are a tuple, they are unpacked and forwarded to
+   * `Target::Execute(type, args...)` by reference, so arguments such as payload
+   * spans are not copied.
+   *
+   * @tparam Type The type of operation IDs.
+   * @tparam Op The type of operation arguments.
+   * @param target A target implementation.
+   * @param type The type of an operation.
+   * @param op Operation arguments.
+   * @return The number of executions for throughput.
+   */
+  template <class Type, class Op>
+  static auto
+  Execute(  //
+      Target &target,
+      [[maybe_unused]] const Type type,
+      const Op &op)  //
+      -> size_t
+  {
+    if constexpr (HasVariantOPs<OperationEngine>) {
+      return target.Execute(op);
+    } else if constexpr (IsTuple<Op>::value) {
+      return std::apply([&](const auto &...args) { return target.Execute(type, args...); }, op);
+    } else {
+      return target.Execute(type, op);
+    }
+  }
+
+  /**
+   * @brief Call `Target::SetUpForWorker` with a worker ID if it accepts one.
+   *
+   * @param target A target implementation.
+   * @param worker_id A unique worker ID.
+   */
+  static void
+  SetUpTarget(  //
+      Target &target,
+      [[maybe_unused]] const size_t worker_id)
+  {
+    if constexpr (HasWorkerID<Target>) {
+      target.SetUpForWorker(worker_id);
+    } else {
+      target.SetUpForWorker();
+    }
+  }
+
+  /**
+   * @brief Execute and measure a sub-operation of fan-out.
+   *
+   * @param target A target implementation.
+   * @param ops A sub-operation.
+   * @return The measurement result of a given sub-operation.
+   */
+  static auto
+  MeasureSubOP(  //
+      Target &target,
+      const OPs &ops)  //
+      -> SubOPResult
+  {
+    SubOPResult res{};
+    Dispatch(ops, [&](const auto type, const auto &op) {
+      StopWatch stopwatch{};
+      stopwatch.Start();
+      res.cnt = Execute(target, type, op);
+      stopwatch.Stop();
+      res.type = type;
+      res.lat = stopwatch.GetNanoDuration();
+    });
+    return res;
+  }
+
+  /**
+   * @brief Execute a logical operation that fans out to sub-operations.
+   *
+   * This function consumes up to `fan_out_` operations from the iterator, so
+   * the iterator points to the last consumed one after this call. Each
+   * sub-operation is recorded in `sub_sketch_` and key buckets.
+   *
+   * @return The type of the first sub-operation and the maximum latency [ns].
+   */
+  auto
+  ExecuteFanOut()  //
+      -> std::pair<size_t, size_t>
+  {
+    size_t type = 0;
+    size_t max_lat = 0;
+    const auto &record = [&](const OPs &ops, const SubOPResult &res) {
+      sub_sketch_.Add(res.type, res.cnt, res.lat);
+      max_lat = std::max(max_lat, res.lat);
+      Dispatch(ops, [&](const auto, const auto &op) {  //
+        AddToKeyBucket(res.type, op, res.cnt, res.lat);
+      });
+    };
+
+    if (!helpers_) {
+      for (size_t i = 0;;) {
+        const auto &ops = *iter_;
+        const auto &res = MeasureSubOP(target_, ops);
+        if (i == 0) {
+          type = res.type;
+        }
+        record(ops, res);
+        if (++i == fan_out_) break;
+        ++iter_;
+        if (!iter_) break;
+      }
+      end_time_ = Clock_t::now();
+      return {type, max_lat};
+    }
+
+    auto &batch = helpers_->GetOPs();
+    batch.clear();
+    batch.emplace_back(*iter_);
+    for (size_t i = 1; i < fan_out_; ++i) {
+      ++iter_;
+      if (!iter_) break;
+      batch.emplace_back(*iter_);
+    }
+    helpers_->Issue();
+    const auto &first = MeasureSubOP(target_, batch.front());
+    helpers_->Wait();
+    end_time_ = Clock_t::now();
+
+    type = first.type;
+    record(batch.front(), first);
+    for (size_t i = 1; i < batch.size(); ++i) {
+      record(batch[i], helpers_->GetResult(i));
+    }
+    return {type, max_lat};
+  }
+
+  /**
+   * @return The timestamp of the next stall (the maximum if this worker is not
+   * a straggler).
+   */
+  [[nodiscard]] auto
+  GetNextStall() const  //
+      -> Clock_t::time_point
+  {
+    if (stall_ == nullptr) return Clock_t::time_point::max();
+    return Clock_t::now() + NanoSec{stall_->period_nano};
+  }
+
+  /**
+   * @param type The type of an executed operation.
+   * @param lat Measured latency [ns].
+   * @return A raw latency record of the last operation.
+   */
+  [[nodiscard]] auto
+  MakeRecord(  //
+      const size_t type,
+      const size_t lat) const  //
+      -> LatencyRecord
+  {
+    const auto timestamp = std::chrono::duration_cast<NanoSec>(end_time_.time_since_epoch());
+    return LatencyRecord{static_cast<uint64_t>(timestamp.count()), lat,
+                         static_cast<uint32_t>(thread_id_), static_cast<uint32_t>(type)};
+  }
+
+  /**
+   * @brief Add latency to the bucket of a given operation argument.
+   *
+   * If an operation engine does not provide `GetKeyBucket`, this function is
+   * compiled out. Bucket IDs exceeding the number of buckets are counted in
+   * the last bucket.
+   *
+   * @param type The type of an executed operation.
+   * @param op Operation arguments.
+   * @param cnt The number of executions for throughput.
+   * @param lat Measured latency [ns].
+   */
+  template <class Arg>
+  void
+  AddToKeyBucket(  //
+      [[maybe_unused]] const size_t type,
+      [[maybe_unused]] const Arg &op,
+      [[maybe_unused]] const size_t cnt,
+      [[maybe_unused]] const size_t lat)
+  {
+    if constexpr (HasKeyBucket<OperationEngine>) {
+      if (bucket_sketches_.empty()) return;
+
+      const auto id = std::min<size_t>(op_engine_.GetKeyBucket(op), bucket_sketches_.size() - 1);
+      bucket_sketches_[id].Add(type, cnt, lat);
+    }
+  }
+
+  /**
+   * @brief Measure execution time for operations that arrive at fixed intervals.
+   *
+   * @param deadline A timestamp to stop measuring.
+   * @param ring A ring buffer for raw latency logs if needed.
+   * @param live A sketch for live snapshots if needed.
+   * @param sketch A sketch for recording latency.
+   */
+  void
+  MeasureOpenLoop(  //
+      const Clock_t::time_point &deadline,
+      LatencyRing *ring,
+      SnapshotSketch *live,
+      SimpleDDSketch *sketch)
+  {
+    auto arrival = start_time_;
+    auto next_stall = GetNextStall();
+    for (size_t i = 1; iter_ && arrival < deadline; ++iter_, ++i) [[likely]] {
+      if (end_time_ >= next_stall) [[unlikely]] {
+        Straggler::Trigger(*stall_);
+        next_stall = GetNextStall();
+      }
+      while (Clock_t::now() < arrival) {
+        // wait for the scheduled arrival time
+        if (!is_running_.load(kRelaxed)) {
+          end_time_ = Clock_t::now();
+          return;
+        }
+        if (live != nullptr && live->IsRequested()) {
+          sketch = &live->Publish();
+        }
+      }
+
+      if (fan_out_ > 1) [[unlikely]] {
+        // the queueing delay is added to the latency of a logical operation
+        const auto delay = std::chrono::duration_cast<NanoSec>(Clock_t::now() - arrival).count();
+        const auto [type, max_lat] = ExecuteFanOut();
+        const auto lat = delay + max_lat;
+        sketch->Add(type, 1, lat);
+        if (ring != nullptr) {
+          ring->Push(MakeRecord(type, lat));
+        }
+        if (!iter_) break;
+      } else {
+        Dispatch([&](const auto type, const auto &op) {
+          const auto cnt = Execute(target_, type, op);
+          end_time_ = Clock_t::now();
+          const auto lat = std::chrono::duration_cast<NanoSec>(end_time_ - arrival).count();
+          sketch->Add(type, cnt, lat);
+          if (ring != nullptr) {
+            ring->Push(MakeRecord(type, lat));
+          }
+          AddToKeyBucket(type, op, cnt, lat);
+        });
+      }
+      if (end_time_ >= deadline) [[unlikely]] break;
+      arrival += interval_;
+      if ((i & kStopCheckMask) == 0) [[unlikely]] {
+        if (!is_running_.load(kRelaxed)) break;
+        if (live != nullptr && live->IsRequested()) {
+          sketch = &live->Publish();
+        }
+      }
+    }
+  }
+
   /*##########################################################################*
    * Internal constants
    *##########################################################################*/
@@ -123,6 +837,29 @@ class Worker
   /// @brief The alias of `std::memory_order_relaxed`.
   static constexpr auto kRelaxed = std::memory_order_relaxed;
 
+  /// @brief The number of operation types.
+  static constexpr size_t kOPsNum = OperationEngine::OPType::kTotalNum;
+
+  // variant alternatives must correspond to operation types
+  static_assert([] {
+    if constexpr (HasVariantOPs<OperationEngine>) {
+      return std::variant_size_v<OPs> == kOPsNum;
+    } else {
+      return true;
+    }
+  }());
+
+  /// @brief The number of operations between checks of the shared stop flag.
+  static constexpr size_t kStopCheckInterval = 64;
+
+  /// @brief A bit mask for checking the stop flag every `kStopCheckInterval`.
+  static constexpr size_t kStopCheckMask = kStopCheckInterval - 1;
+
+  static_assert((kStopCheckInterval & kStopCheckMask) == 0);
+
+  /// @brief The maximum delay regarded as starting at the given timestamp.
+  static constexpr auto kStartTolerance = std::chrono::microseconds{100};
+
   /*##########################################################################*
    * Internal member variables
    *##########################################################################*/
@@ -136,13 +873,56 @@ class Worker
   /// @brief The iterator of an operation queue.
   OperationEngine::OPIter iter_{};
 
+  /// @brief A flag for monitoring benchmarker's status.
   const std::atomic_bool &is_running_{};
 
+  /// @brief A unique thread ID.
+  size_t thread_id_{};
+
+  /// @brief An interval between operation arrivals (zero for closed-loop).
+  NanoSec interval_{};
+
+  /// @brief The number of sub-operations per logical operation.
+  size_t fan_out_{1};
+
+  /// @brief A model of periodic stalls (null if this worker is not a straggler).
+  const StallModel *stall_{nullptr};
+
+  /// @brief The number of executed stalls.
+  size_t stall_num_{0};
+
+  /// @brief Execution time of the setup hook [ns].
+  size_t setup_nano_{0};
+
+  /// @brief Execution time of the teardown hook [ns].
+  size_t teardown_nano_{0};
+
+  /// @brief A flag for indicating the teardown hook has been called.
+  bool is_torn_down_{false};
+
   /// @brief Measurement results.
   SimpleDDSketch sketch_{};
 
+  /// @brief Measurement results of sub-operations.
+  SimpleDDSketch sub_sketch_{};
+
+  /// @brief Measurement results for each key bucket.
+  std::vector<SimpleDDSketch> bucket_sketches_{};
+
+  /// @brief Target-defined metrics.
+  MetricsRegistry metrics_{};
+
   /// @brief A stopwatch to measure execution time.
   StopWatch stopwatch_{};
+
+  /// @brief The timestamp when this worker started measuring.
+  Clock_t::time_point start_time_{};
+
+  /// @brief The timestamp when the last operation finished.
+  Clock_t::time_point end_time_{};
+
+  /// @brief Helper threads for issuing sub-operations in parallel.
+  std::unique_ptr<FanOutGroup<OPs>> helpers_{};
 };
 
 }  // namespace dbgroup::benchmark::component
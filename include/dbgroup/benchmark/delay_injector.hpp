@@ -0,0 +1,232 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DBGROUP_BENCHMARK_DELAY_INJECTOR_HPP_
+#define DBGROUP_BENCHMARK_DELAY_INJECTOR_HPP_
+
+// C++ standard libraries
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+#include <utility>
+
+// local sources
+#include "dbgroup/benchmark/component/delay.hpp"
+#include "dbgroup/benchmark/component/worker.hpp"
+
+namespace dbgroup::benchmark
+{
+/**
+ * @brief A target wrapper for injecting delays into a wrapped target.
+ *
+ * This class forwards all the calls to a wrapped target and busy-waits for a
+ * sampled delay before and/or after each `Execute` call, so latency
+ * sensitivity can be explored without changing target code. Since a wrapper
+ * cannot reach into `Execute`, a target may call `Inject` by itself (e.g.,
+ * inside a critical section) with the `kInside` position.
+ *
+ * @tparam Target An actual target implementation.
+ */
+template <class Target>
+class DelayInjector
+{
+ public:
+  /*##########################################################################*
+   * Public types
+   *##########################################################################*/
+
+  using DelayModel = component::DelayModel;
+
+  /**
+   * @brief Positions of injected delays.
+   *
+   */
+  enum Position : uint8_t {
+    kBefore = 0,
+    kAfter,
+    kAround,
+    kInside,
+  };
+
+  /*##########################################################################*
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  /**
+   * @brief Construct a new DelayInjector object.
+   *
+   * @param target A reference to an actual target implementation.
+   * @param model A model of injected delays.
+   * @param pos The position of injected delays.
+   * @param rand_seed A base random seed for sampling delays.
+   */
+  DelayInjector(  //
+      Target &target,
+      const DelayModel &model,
+      const Position pos = kBefore,
+      const size_t rand_seed = std::random_device{}())
+      : target_{target}, model_{model}, pos_{pos}, rand_seed_{rand_seed}
+  {
+    // calibrate spin loops before measurements
+    [[maybe_unused]] const auto iter_per_nano = component::SpinDelay::GetIterPerNano();
+  }
+
+  DelayInjector(const DelayInjector &) = delete;
+  DelayInjector(DelayInjector &&) = delete;
+
+  auto operator=(const DelayInjector &obj) -> DelayInjector & = delete;
+  auto operator=(DelayInjector &&) -> DelayInjector & = delete;
+
+  /*##########################################################################*
+   * Public destructors
+   *##########################################################################*/
+
+  ~DelayInjector() = default;
+
+  /*##########################################################################*
+   * Public APIs for benchmarking
+   *##########################################################################*/
+
+  /**
+   * @brief Prepare a random number generator for the current thread and
+   * forward the preprocessing of a worker to a wrapped target.
+   *
+   * @param worker_id A unique worker ID given by `component::Worker`.
+   * @note A generator is seeded by the base random seed and a worker ID, so
+   * the same seed reproduces the same delays in each worker.
+   */
+  void
+  SetUpForWorker(  //
+      const size_t worker_id = 0)
+  {
+    if constexpr (component::HasWorkerID<Target>) {
+      target_.SetUpForWorker(worker_id);
+    } else {
+      target_.SetUpForWorker();
+    }
+    rands_.insert_or_assign(id_, std::mt19937_64{rand_seed_ + worker_id});
+    cached_id_ = 0;
+  }
+
+  /**
+   * @brief Forward the postprocessing of a worker to a wrapped target and
+   * release the random number generator of the current thread.
+   *
+   */
+  void
+  TearDownForWorker()
+  {
+    target_.TearDownForWorker();
+    rands_.erase(id_);
+    cached_id_ = 0;
+  }
+
+  /**
+   * @brief Execute an operation in a wrapped target with injected delays.
+   *
+   * @tparam Args The types of operation arguments.
+   * @param args Operation arguments.
+   * @return The number of executions returned by a wrapped target.
+   */
+  template <class... Args>
+  auto
+  Execute(  //
+      Args &&...args)  //
+      -> size_t
+  {
+    if (pos_ == kBefore || pos_ == kAround) {
+      Inject();
+    }
+    const auto cnt = target_.Execute(std::forward<Args>(args)...);
+    if (pos_ == kAfter || pos_ == kAround) {
+      Inject();
+    }
+    return cnt;
+  }
+
+  /*##########################################################################*
+   * Public utility functions
+   *##########################################################################*/
+
+  /**
+   * @brief Busy-wait for a delay sampled from the model.
+   *
+   * Each thread has its own random number generator per injector, which is
+   * prepared by `SetUpForWorker`. Thus, this function can be called
+   * concurrently without synchronization, and injectors sample independent
+   * delays even if they share threads.
+   *
+   * @note A thread that has not called `SetUpForWorker` uses a generator
+   * seeded by the base random seed, which is kept until the thread exits.
+   */
+  void
+  Inject() const
+  {
+    if (cached_id_ != id_) [[unlikely]] {
+      cached_rand_ = &(rands_.try_emplace(id_, rand_seed_).first->second);
+      cached_id_ = id_;
+    }
+    component::SpinDelay::Wait(model_.Sample(*cached_rand_));
+  }
+
+  /**
+   * @return A wrapped target.
+   */
+  [[nodiscard]] constexpr auto
+  GetTarget()  //
+      -> Target &
+  {
+    return target_;
+  }
+
+ private:
+  /*##########################################################################*
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief A wrapped target.
+  Target &target_{};
+
+  /// @brief A model of injected delays.
+  DelayModel model_{};
+
+  /// @brief The position of injected delays.
+  Position pos_{kBefore};
+
+  /// @brief A base random seed.
+  size_t rand_seed_{};
+
+  /// @brief A unique ID for finding per-thread random number generators.
+  size_t id_{id_counter_.fetch_add(1, std::memory_order_relaxed) + 1};
+
+  /// @brief A counter for assigning unique IDs to injectors.
+  static inline std::atomic_size_t id_counter_{0};
+
+  /// @brief Random number generators of the current thread for each injector.
+  static inline thread_local std::unordered_map<size_t, std::mt19937_64> rands_{};
+
+  /// @brief The ID of an injector that used `cached_rand_` last.
+  static inline thread_local size_t cached_id_{0};
+
+  /// @brief The generator of the current thread for `cached_id_`.
+  static inline thread_local std::mt19937_64 *cached_rand_{nullptr};
+};
+
+}  // namespace dbgroup::benchmark
+
+#endif  // DBGROUP_BENCHMARK_DELAY_INJECTOR_HPP_
@@ -0,0 +1,182 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// the corresponding header
+#include "dbgroup/benchmark/component/comparison.hpp"
+
+// C++ standard libraries
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <fstream>
+#include <iomanip>
+#include <ios>
+#include <iterator>
+#include <iostream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// local sources
+#include "dbgroup/benchmark/component/measurements.hpp"
+
+namespace dbgroup::benchmark::component
+{
+namespace
+{
+/*############################################################################*
+ * Local constants
+ *############################################################################*/
+
+/// @brief The number of quantiles in [0.01, 0.99] for ratio curves.
+constexpr size_t kPercentileNum = 99;
+
+/// @brief Additional tail quantiles for ratio curves.
+constexpr double kTailQuantiles[] = {0.999, 0.9999};  // NOLINT
+
+/*############################################################################*
+ * Local utilities
+ *############################################################################*/
+
+/**
+ * @param ratio The ratio of target to base latency.
+ * @return The divergence of a given ratio.
+ */
+auto
+Divergence(  //
+    const double ratio)  //
+    -> double
+{
+  return std::abs(std::log(ratio));
+}
+
+}  // namespace
+
+DistributionComparison::DistributionComparison(  //
+    const SimpleDDSketch &base,
+    const SimpleDDSketch &target,
+    const size_t ops_id)
+{
+  if (!base.HasLatency(ops_id) || !target.HasLatency(ops_id)) return;
+
+  // compare CDFs at the upper bound of each bin
+  const auto base_num = static_cast<double>(base.GetExecNum(ops_id));
+  const auto target_num = static_cast<double>(target.GetExecNum(ops_id));
+  size_t base_cnt = 0;
+  size_t target_cnt = 0;
+  size_t lower = 0;
+  for (size_t pos = 0; pos < SimpleDDSketch::kBinNum; ++pos) {
+    base_cnt += base.GetBinCount(ops_id, pos);
+    target_cnt += target.GetBinCount(ops_id, pos);
+    const auto upper = SimpleDDSketch::GetBinUpperBound(pos);
+    const auto gap = std::abs(static_cast<double>(base_cnt) / base_num
+                              - static_cast<double>(target_cnt) / target_num);
+    if (gap > ks_distance_) {
+      ks_distance_ = gap;
+      ks_latency_ = upper;
+    }
+    wasserstein_ += gap * static_cast<double>(upper - lower);
+    lower = upper;
+  }
+
+  // compute the ratio curve
+  const auto add_ratio = [&](const double q) {
+    const auto b = base.Quantile(ops_id, q);
+    const auto t = target.Quantile(ops_id, q);
+    const auto ratio =
+        static_cast<double>(std::max(t, 1UL)) / static_cast<double>(std::max(b, 1UL));
+    ratios_.emplace_back(QuantileRatio{q, b, t, ratio});
+  };
+  ratios_.reserve(kPercentileNum + std::size(kTailQuantiles));
+  for (size_t i = 1; i <= kPercentileNum; ++i) {
+    add_ratio(static_cast<double>(i) / 100.0);  // NOLINT
+  }
+  for (const auto q : kTailQuantiles) {
+    add_ratio(q);
+  }
+}
+
+auto
+DistributionComparison::GetMostDivergentQuantiles(  //
+    const size_t num) const                         //
+    -> std::vector<QuantileRatio>
+{
+  auto ratios = ratios_;
+  std::stable_sort(ratios.begin(), ratios.end(), [](const auto &lhs, const auto &rhs) {
+    return Divergence(lhs.ratio) > Divergence(rhs.ratio);
+  });
+  ratios.resize(std::min(num, ratios.size()));
+  return ratios;
+}
+
+void
+DistributionComparison::Report(  //
+    std::ostream &os,
+    const std::string &label,
+    const size_t num) const
+{
+  const auto flags = os.flags();
+  os << std::fixed;
+  os << label << ":\n"
+     << "  KS distance: " << std::setprecision(3) << ks_distance_  //
+     << " (at " << ks_latency_ << " ns)\n"
+     << "  Wasserstein distance: " << std::setprecision(1) << wasserstein_ << " ns\n"
+     << "  Most divergent quantiles (base -> target [ns]):\n";
+  for (const auto &[q, b, t, ratio] : GetMostDivergentQuantiles(num)) {
+    os << "    " << std::setprecision(2) << q * 100 << "%: "  // NOLINT
+       << b << " -> " << t << " (x" << ratio << ")\n";
+  }
+  os.flags(flags);
+}
+
+void
+DistributionComparison::Report(  //
+    std::ostream &os,
+    const SimpleDDSketch &base,
+    const SimpleDDSketch &target)
+{
+  const auto ops_num = std::min(base.GetOPsNum(), target.GetOPsNum());
+  for (size_t id = 0; id < ops_num; ++id) {
+    if (!base.HasLatency(id) || !target.HasLatency(id)) continue;
+    DistributionComparison{base, target, id}.Report(os, "OPS ID " + std::to_string(id));
+  }
+}
+
+auto
+DistributionComparison::ReportFiles(  //
+    std::ostream &os,
+    const std::string &base_path,
+    const std::string &target_path)  //
+    -> bool
+{
+  std::ifstream base_ifs{base_path, std::ios::binary};
+  const auto &base = SimpleDDSketch::Deserialize(base_ifs);
+  if (!base) {
+    std::cerr << "WARNING: failed to read a sketch from " << base_path << "\n";
+    return false;
+  }
+  std::ifstream target_ifs{target_path, std::ios::binary};
+  const auto &target = SimpleDDSketch::Deserialize(target_ifs);
+  if (!target) {
+    std::cerr << "WARNING: failed to read a sketch from " << target_path << "\n";
+    return false;
+  }
+
+  Report(os, *base, *target);
+  return true;
+}
+
+}  // namespace dbgroup::benchmark::component
@@ -0,0 +1,121 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// the corresponding header
+#include "dbgroup/benchmark/component/delay.hpp"
+
+// C++ standard libraries
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+
+// local sources
+#include "dbgroup/benchmark/component/stopwatch.hpp"
+
+namespace dbgroup::benchmark::component
+{
+/*############################################################################*
+ * DelayModel
+ *############################################################################*/
+
+auto
+DelayModel::Sample(  //
+    std::mt19937_64 &rand) const  //
+    -> size_t
+{
+  size_t delay = delay_nano;
+  if (type == kUniform && spread_nano > 0) {
+    delay += std::uniform_int_distribution<size_t>{0, spread_nano}(rand);
+  } else if (type == kExponential && delay_nano > 0) {
+    const auto mean = static_cast<double>(delay_nano);
+    delay = static_cast<size_t>(std::exponential_distribution<double>{1.0 / mean}(rand));
+  }
+  if (spike_prob > 0 && std::bernoulli_distribution{spike_prob}(rand)) {
+    delay += spike_nano;
+  }
+  return delay;
+}
+
+/*############################################################################*
+ * SpinDelay
+ *############################################################################*/
+
+void
+SpinDelay::Wait(  //
+    const size_t nano)
+{
+  if (nano == 0) return;
+
+  const auto iter_per_nano = GetIterPerNano();
+  if (nano <= kChunkNano) {
+    Spin(static_cast<size_t>(static_cast<double>(nano) * iter_per_nano));
+    return;
+  }
+
+  using Clock_t = std::chrono::high_resolution_clock;
+  const auto chunk = static_cast<size_t>(static_cast<double>(kChunkNano) * iter_per_nano);
+  const auto &deadline = Clock_t::now() + std::chrono::nanoseconds{nano};
+  for (auto now = Clock_t::now(); now < deadline; now = Clock_t::now()) {
+    const auto rest = std::chrono::nanoseconds{deadline - now}.count();
+    Spin(std::min(chunk, static_cast<size_t>(static_cast<double>(rest) * iter_per_nano)));
+  }
+}
+
+auto
+SpinDelay::GetIterPerNano()  //
+    -> double
+{
+  static const auto iter_per_nano = Calibrate();
+  return iter_per_nano;
+}
+
+void
+SpinDelay::Spin(  //
+    const size_t iter_num)
+{
+  constexpr uint64_t kMul = 6364136223846793005UL;
+  constexpr uint64_t kInc = 1442695040888963407UL;
+  static volatile uint64_t sink{};  // NOLINT
+
+  uint64_t x = sink;
+  for (size_t i = 0; i < iter_num; ++i) {
+    x = x * kMul + kInc;
+  }
+  sink = x;
+}
+
+auto
+SpinDelay::Calibrate()  //
+    -> double
+{
+  std::array<size_t, kCalibrationTrialNum> times{};
+  StopWatch stopwatch{};
+  Spin(kCalibrationIterNum);  // warm up
+  for (auto &&time : times) {
+    stopwatch.Start();
+    Spin(kCalibrationIterNum);
+    stopwatch.Stop();
+    time = std::max<size_t>(stopwatch.GetNanoDuration(), 1);
+  }
+  std::sort(times.begin(), times.end());
+  return static_cast<double>(kCalibrationIterNum)
+         / static_cast<double>(times[kCalibrationTrialNum / 2]);
+}
+
+}  // namespace dbgroup::benchmark::component
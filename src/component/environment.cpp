@@ -0,0 +1,264 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// the corresponding header
+#include "dbgroup/benchmark/component/environment.hpp"
+
+// C++ standard libraries
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// system libraries
+#include <sys/utsname.h>
+
+// local sources
+#include "dbgroup/benchmark/component/stopwatch.hpp"
+
+namespace dbgroup::benchmark::component
+{
+namespace
+{
+/*############################################################################*
+ * Local constants
+ *############################################################################*/
+
+/// @brief A string for representing unavailable information.
+constexpr auto kUnknown = "unknown";
+
+/*############################################################################*
+ * Local utilities
+ *############################################################################*/
+
+/**
+ * @param path A file path.
+ * @return The first line of a given file (an empty string if not readable).
+ */
+auto
+ReadFirstLine(  //
+    const char *path)  //
+    -> std::string
+{
+  std::ifstream ifs{path};
+  std::string line{};
+  std::getline(ifs, line);
+  return line;
+}
+
+/**
+ * @return The model name of CPUs.
+ */
+auto
+ReadCPUModel()  //
+    -> std::string
+{
+  constexpr std::string_view kKey = "model name";
+
+  std::ifstream ifs{"/proc/cpuinfo"};
+  for (std::string line{}; std::getline(ifs, line);) {
+    if (line.compare(0, kKey.size(), kKey) != 0) continue;
+    const auto pos = line.find(':');
+    if (pos == std::string::npos) break;
+    return line.substr(line.find_first_not_of(' ', pos + 1));
+  }
+  return kUnknown;
+}
+
+/**
+ * @return The state of turbo boost.
+ */
+auto
+ReadTurboState()  //
+    -> std::string
+{
+  if (const auto &no_turbo = ReadFirstLine("/sys/devices/system/cpu/intel_pstate/no_turbo");
+      !no_turbo.empty()) {
+    return (no_turbo == "0") ? "on" : "off";
+  }
+  if (const auto &boost = ReadFirstLine("/sys/devices/system/cpu/cpufreq/boost");
+      !boost.empty()) {
+    return (boost == "1") ? "on" : "off";
+  }
+  return kUnknown;
+}
+
+/**
+ * @brief Spin a fixed number of iterations and return the elapsed time.
+ *
+ * @param iter_num The number of iterations.
+ * @return Elapsed time [ns].
+ */
+auto
+Spin(  //
+    const size_t iter_num)  //
+    -> size_t
+{
+  constexpr uint64_t kMul = 6364136223846793005UL;
+  constexpr uint64_t kInc = 1442695040888963407UL;
+  static volatile uint64_t sink{};  // NOLINT
+
+  StopWatch stopwatch{};
+  stopwatch.Start();
+  uint64_t x = sink;
+  for (size_t i = 0; i < iter_num; ++i) {
+    x = x * kMul + kInc;
+  }
+  sink = x;
+  stopwatch.Stop();
+  return stopwatch.GetNanoDuration();
+}
+
+}  // namespace
+
+Environment::Environment(  //
+    std::string compiler_info)
+    : cpu_model_{ReadCPUModel()},
+      cpu_num_{std::thread::hardware_concurrency()},
+      governor_{ReadFirstLine("/sys/devices/system/cpu/cpu0/cpufreq/scaling_governor")},
+      turbo_{ReadTurboState()},
+      isolated_cpus_{ReadFirstLine("/sys/devices/system/cpu/isolated")},
+      compiler_info_{std::move(compiler_info)},
+      build_info_{CPP_BENCH_BUILD_INFO}
+{
+  if (governor_.empty()) {
+    governor_ = kUnknown;
+  }
+  if (isolated_cpus_.empty()) {
+    isolated_cpus_ = "none";
+  }
+
+  const auto &smt = ReadFirstLine("/sys/devices/system/cpu/smt/active");
+  smt_ = smt.empty() ? kUnknown : ((smt == "1") ? "on" : "off");
+
+  constexpr int kLoadAvgNum = 3;
+  load_avg_.resize(kLoadAvgNum);
+  if (getloadavg(load_avg_.data(), kLoadAvgNum) != kLoadAvgNum) {
+    load_avg_.clear();
+  }
+
+  utsname uts{};
+  if (uname(&uts) == 0) {
+    kernel_ = std::string{uts.sysname} + " " + uts.release + " " + uts.machine;
+  } else {
+    kernel_ = kUnknown;
+  }
+}
+
+void
+Environment::CheckNoise(  //
+    const size_t thread_num)
+{
+  warnings_.clear();
+  is_noisy_ = false;
+
+  /*--------------------------------------------------------------------------*
+   * Check static settings
+   *--------------------------------------------------------------------------*/
+  if (governor_ != kUnknown && governor_ != "performance") {
+    warnings_.emplace_back("the CPU frequency governor is '" + governor_ + "'.");
+  }
+  if (turbo_ == "on") {
+    warnings_.emplace_back("turbo boost is enabled.");
+  }
+  if (compiler_info_.find("not optimized") != std::string::npos) {
+    warnings_.emplace_back("benchmarking code is not optimized.");
+  }
+  if (cpu_num_ > 0 && thread_num > cpu_num_) {
+    warnings_.emplace_back("worker threads exceed logical CPUs.");
+  }
+  if (!load_avg_.empty() && cpu_num_ > 0
+      && load_avg_.front() + static_cast<double>(thread_num) > static_cast<double>(cpu_num_)) {
+    warnings_.emplace_back("the load average (" + std::to_string(load_avg_.front())
+                           + ") indicates other processes may be busy.");
+  }
+
+  /*--------------------------------------------------------------------------*
+   * Measure spin time on each worker thread
+   *--------------------------------------------------------------------------*/
+  if (thread_num == 0) return;
+
+  std::atomic_size_t ready_cnt{0};
+  std::vector<size_t> mins(thread_num, ~0UL);
+  std::vector<size_t> medians(thread_num, 0);
+  std::vector<std::thread> threads{};
+  threads.reserve(thread_num);
+  for (size_t i = 0; i < thread_num; ++i) {
+    threads.emplace_back([&, i]() {
+      ready_cnt.fetch_add(1, std::memory_order_relaxed);
+      while (ready_cnt.load(std::memory_order_relaxed) < thread_num) {
+        // wait for the other threads to spin simultaneously
+      }
+
+      std::vector<size_t> times(kTrialNum);
+      for (auto &&time : times) {
+        time = Spin(kSpinNum);
+      }
+      std::sort(times.begin(), times.end());
+      mins[i] = times.front();
+      medians[i] = times[kTrialNum / 2];
+    });
+  }
+  for (auto &&t : threads) {
+    t.join();
+  }
+
+  min_spin_ = *std::min_element(mins.begin(), mins.end());
+  max_spin_ = *std::max_element(medians.begin(), medians.end());
+  if (static_cast<double>(max_spin_) > static_cast<double>(min_spin_) * kSpinTolerance) {
+    warnings_.emplace_back("spin time varies among worker threads ("
+                           + std::to_string(min_spin_) + " ns to " + std::to_string(max_spin_)
+                           + " ns).");
+    is_noisy_ = true;
+  }
+}
+
+void
+Environment::Report(  //
+    std::ostream &os) const
+{
+  os << "Environment:\n"
+     << "  CPU model: " << cpu_model_ << "\n"
+     << "  Logical CPUs: " << cpu_num_ << "\n"
+     << "  Governor: " << governor_ << "\n"
+     << "  Turbo boost: " << turbo_ << "\n"
+     << "  SMT: " << smt_ << "\n"
+     << "  Isolated CPUs: " << isolated_cpus_ << "\n"
+     << "  Load average:";
+  if (load_avg_.empty()) {
+    os << " " << kUnknown;
+  }
+  for (const auto load : load_avg_) {
+    os << " " << load;
+  }
+  os << "\n"
+     << "  Kernel: " << kernel_ << "\n"
+     << "  Compiler: " << compiler_info_ << "\n"
+     << "  Library build: " << build_info_ << "\n";
+  if (max_spin_ > 0) {
+    os << "  Spin time [ns]: " << min_spin_ << " (fastest), " << max_spin_ << " (slowest median)\n";
+  }
+}
+
+}  // namespace dbgroup::benchmark::component
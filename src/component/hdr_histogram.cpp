@@ -0,0 +1,295 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// the corresponding header
+#include "dbgroup/benchmark/component/hdr_histogram.hpp"
+
+// C++ standard libraries
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// local sources
+#include "dbgroup/benchmark/component/measurements.hpp"
+
+namespace dbgroup::benchmark::component
+{
+namespace
+{
+/*############################################################################*
+ * Local constants
+ *############################################################################*/
+
+/// @brief The cookie of the V2 encoding with 8-byte words.
+constexpr uint32_t kEncodingCookie = 0x1c849313;
+
+/// @brief The cookie of the V2 compressed encoding with 8-byte words.
+constexpr uint32_t kCompressedCookie = 0x1c849314;
+
+/// @brief The number of significant digits of exported histograms.
+constexpr uint32_t kSigDigits = 2;
+
+/// @brief The lowest discernible value of exported histograms.
+constexpr uint64_t kLowestValue = 1;
+
+/// @brief log2 of a half of sub-buckets (i.e., 2^ceil(log2(2 * 10^2)) / 2).
+constexpr uint64_t kSubBucketHalfCountMag = 7;
+
+/// @brief A half of sub-buckets.
+constexpr uint64_t kSubBucketHalfCount = 1UL << kSubBucketHalfCountMag;
+
+/// @brief A mask for sub-buckets.
+constexpr uint64_t kSubBucketMask = (kSubBucketHalfCount << 1UL) - 1;
+
+/// @brief The maximum length of stored deflate blocks.
+constexpr size_t kMaxStoredLen = 0xFFFF;
+
+/// @brief The modulus of Adler-32.
+constexpr uint32_t kAdlerMod = 65521;
+
+/*############################################################################*
+ * Local utilities
+ *############################################################################*/
+
+/**
+ * @param value A recorded value.
+ * @return The index of HdrHistogram's counts array for a given value.
+ */
+auto
+CountsIndex(  //
+    const uint64_t value)  //
+    -> size_t
+{
+  const auto bucket = 64 - kSubBucketHalfCountMag - 1 - std::countl_zero(value | kSubBucketMask);
+  const auto sub_bucket = value >> bucket;
+  return ((bucket + 1) << kSubBucketHalfCountMag) + sub_bucket - kSubBucketHalfCount;
+}
+
+/**
+ * @brief Append an integer in big-endian.
+ *
+ * @tparam T An integer type.
+ * @param val An integer value.
+ * @param out An output buffer.
+ */
+template <class T>
+void
+PutBigEndian(  //
+    const T val,
+    std::vector<uint8_t> &out)
+{
+  for (size_t i = sizeof(T); i > 0; --i) {
+    out.emplace_back(static_cast<uint8_t>(val >> (8 * (i - 1))));
+  }
+}
+
+/**
+ * @brief Append an integer in ZigZag LEB128.
+ *
+ * @param val An integer value.
+ * @param out An output buffer.
+ */
+void
+PutZigZag(  //
+    const int64_t val,
+    std::vector<uint8_t> &out)
+{
+  auto zz = (static_cast<uint64_t>(val) << 1UL) ^ static_cast<uint64_t>(val >> 63);  // NOLINT
+  while (zz >= 0x80) {
+    out.emplace_back(static_cast<uint8_t>(zz | 0x80U));
+    zz >>= 7U;
+  }
+  out.emplace_back(static_cast<uint8_t>(zz));
+}
+
+/**
+ * @brief Wrap given data by a zlib stream without compression.
+ *
+ * @param data Raw data.
+ * @return A zlib stream of stored blocks.
+ */
+auto
+ZlibStore(  //
+    const std::vector<uint8_t> &data)  //
+    -> std::vector<uint8_t>
+{
+  std::vector<uint8_t> out{0x78, 0x01};
+  size_t pos = 0;
+  do {
+    const auto len = std::min(kMaxStoredLen, data.size() - pos);
+    const auto is_final = pos + len == data.size();
+    out.emplace_back(is_final ? 1 : 0);
+    out.emplace_back(static_cast<uint8_t>(len & 0xFFU));
+    out.emplace_back(static_cast<uint8_t>(len >> 8U));
+    out.emplace_back(static_cast<uint8_t>(~len & 0xFFU));
+    out.emplace_back(static_cast<uint8_t>((~len >> 8U) & 0xFFU));
+    out.insert(out.end(), data.begin() + pos, data.begin() + pos + len);
+    pos += len;
+  } while (pos < data.size());
+
+  uint32_t a = 1;
+  uint32_t b = 0;
+  for (const auto byte : data) {
+    a = (a + byte) % kAdlerMod;
+    b = (b + a) % kAdlerMod;
+  }
+  PutBigEndian((b << 16U) | a, out);
+  return out;
+}
+
+/**
+ * @param data Raw data.
+ * @return A Base64 string.
+ */
+auto
+EncodeBase64(  //
+    const std::vector<uint8_t> &data)  //
+    -> std::string
+{
+  constexpr const char *kChars =
+      "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+  std::string out{};
+  out.reserve((data.size() + 2) / 3 * 4);
+  for (size_t i = 0; i < data.size(); i += 3) {
+    const auto rem = data.size() - i;
+    uint32_t word = static_cast<uint32_t>(data[i]) << 16U;
+    if (rem > 1) word |= static_cast<uint32_t>(data[i + 1]) << 8U;
+    if (rem > 2) word |= data[i + 2];
+    out += kChars[(word >> 18U) & 0x3FU];
+    out += kChars[(word >> 12U) & 0x3FU];
+    out += (rem > 1) ? kChars[(word >> 6U) & 0x3FU] : '=';
+    out += (rem > 2) ? kChars[word & 0x3FU] : '=';
+  }
+  return out;
+}
+
+}  // namespace
+
+/*############################################################################*
+ * Global utilities
+ *############################################################################*/
+
+auto
+EncodeHdrHistogram(  //
+    const SimpleDDSketch &sketch,
+    const size_t ops_id)  //
+    -> std::string
+{
+  // record representative values of bins into a counts array
+  std::vector<int64_t> counts{};
+  const auto min = sketch.Quantile(ops_id, 0.0);
+  const auto max = sketch.Quantile(ops_id, 1.0);
+  for (size_t pos = 0; pos < SimpleDDSketch::kBinNum; ++pos) {
+    const auto cnt = sketch.GetBinCount(ops_id, pos);
+    if (cnt == 0) continue;
+
+    const auto val = std::clamp(SimpleDDSketch::GetBinValue(pos), min, max);
+    const auto idx = CountsIndex(val);
+    if (idx >= counts.size()) {
+      counts.resize(idx + 1);
+    }
+    counts[idx] += static_cast<int64_t>(cnt);
+  }
+
+  // encode counts with runs of zeros as negative values
+  std::vector<uint8_t> payload{};
+  for (size_t i = 0; i < counts.size();) {
+    size_t zeros = 0;
+    while (i + zeros < counts.size() && counts[i + zeros] == 0) {
+      ++zeros;
+    }
+    if (zeros > 1) {
+      PutZigZag(-static_cast<int64_t>(zeros), payload);
+      i += zeros;
+    } else {
+      PutZigZag(counts[i++], payload);
+    }
+  }
+
+  std::vector<uint8_t> raw{};
+  const auto highest = std::max<uint64_t>(max, 2 * kLowestValue);
+  const auto ratio = std::bit_cast<uint64_t>(1.0);
+  PutBigEndian(kEncodingCookie, raw);
+  PutBigEndian(static_cast<uint32_t>(payload.size()), raw);
+  PutBigEndian(uint32_t{0}, raw);  // normalizing index offset
+  PutBigEndian(kSigDigits, raw);
+  PutBigEndian(kLowestValue, raw);
+  PutBigEndian(highest, raw);
+  PutBigEndian(ratio, raw);
+  raw.insert(raw.end(), payload.begin(), payload.end());
+
+  const auto &zlib = ZlibStore(raw);
+  std::vector<uint8_t> out{};
+  PutBigEndian(kCompressedCookie, out);
+  PutBigEndian(static_cast<uint32_t>(zlib.size()), out);
+  out.insert(out.end(), zlib.begin(), zlib.end());
+  return EncodeBase64(out);
+}
+
+/*############################################################################*
+ * HdrLogWriter
+ *############################################################################*/
+
+HdrLogWriter::HdrLogWriter(  //
+    const std::string &path)
+    : ofs_{path}
+{
+  if (!ofs_) {
+    std::cerr << "WARNING: failed to open '" << path << "', so histograms are not logged.\n";
+    ofs_.close();
+    return;
+  }
+
+  const auto now = std::chrono::system_clock::now().time_since_epoch();
+  const auto now_ms = std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+  std::array<char, 32> start{};
+  std::snprintf(start.data(), start.size(), "%lld.%03lld",  // NOLINT
+                static_cast<long long>(now_ms / 1000), static_cast<long long>(now_ms % 1000));
+  ofs_ << "#[Histogram log format version 1.3]\n"
+       << "#[StartTime: " << start.data() << " (seconds since epoch)]\n"
+       << R"("StartTimestamp","Interval_Length","Interval_Max","Interval_Compressed_Histogram")"
+       << "\n";
+}
+
+void
+HdrLogWriter::Write(  //
+    const SimpleDDSketch &sketch,
+    const double start_sec,
+    const double length_sec)
+{
+  if (!ofs_.is_open()) return;
+
+  for (size_t id = 0; id < sketch.GetOPsNum(); ++id) {
+    if (!sketch.HasLatency(id)) continue;
+
+    const auto max = static_cast<double>(sketch.Quantile(id, 1.0)) / kMaxValueUnitRatio;
+    std::array<char, 96> prefix{};
+    std::snprintf(prefix.data(), prefix.size(), "Tag=OPS_ID_%lu,%.3f,%.3f,%.3f,",  // NOLINT
+                  id, start_sec, length_sec, max);
+    ofs_ << prefix.data() << EncodeHdrHistogram(sketch, id) << "\n";
+  }
+  ofs_.flush();
+}
+
+}  // namespace dbgroup::benchmark::component
@@ -0,0 +1,85 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// the corresponding header
+#include "dbgroup/benchmark/component/heatmap.hpp"
+
+// C++ standard libraries
+#include <array>
+#include <cstddef>
+#include <iostream>
+#include <string>
+
+// local sources
+#include "dbgroup/benchmark/component/measurements.hpp"
+
+namespace dbgroup::benchmark::component
+{
+
+HeatmapWriter::HeatmapWriter(  //
+    const std::string &path)
+    : ofs_{path}
+{
+  if (!ofs_) {
+    std::cerr << "WARNING: failed to open '" << path << "', so heatmaps are not written.\n";
+    ofs_.close();
+    return;
+  }
+
+  ofs_ << "# upper_bounds_ns";
+  for (size_t col = 0; col < kColumnNum; ++col) {
+    ofs_ << "," << SimpleDDSketch::GetBinUpperBound((col + 1) * kBinsPerColumn - 1);
+  }
+  ofs_ << "\nwindow,start_sec,ops_id,first_col,counts\n";
+}
+
+void
+HeatmapWriter::Write(  //
+    const SimpleDDSketch &sketch,
+    const size_t window_id,
+    const double start_sec)
+{
+  if (!ofs_.is_open()) return;
+
+  std::array<size_t, kColumnNum> counts{};
+  for (size_t id = 0; id < sketch.GetOPsNum(); ++id) {
+    if (!sketch.HasLatency(id)) continue;
+
+    counts.fill(0);
+    auto first = kColumnNum;
+    size_t last = 0;
+    for (size_t pos = 0; pos < SimpleDDSketch::kBinNum; ++pos) {
+      const auto cnt = sketch.GetBinCount(id, pos);
+      if (cnt == 0) continue;
+
+      const auto col = pos / kBinsPerColumn;
+      counts[col] += cnt;
+      if (col < first) {
+        first = col;
+      }
+      last = col;
+    }
+
+    ofs_ << window_id << "," << start_sec << "," << id << "," << first << ",";
+    for (auto col = first; col <= last; ++col) {
+      ofs_ << ((col == first) ? "" : " ") << counts[col];
+    }
+    ofs_ << "\n";
+  }
+  ofs_.flush();
+}
+
+}  // namespace dbgroup::benchmark::component
@@ -0,0 +1,126 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// the corresponding header
+#include "dbgroup/benchmark/component/latency_log.hpp"
+
+// C++ standard libraries
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+
+namespace dbgroup::benchmark::component
+{
+
+LatencyLog::LatencyLog(  //
+    const std::string &path)
+    : ofs_{path, std::ios::binary | std::ios::trunc}
+{
+  if (!ofs_) {
+    std::cerr << "WARNING: failed to open '" << path << "', so latency is not logged.\n";
+    ofs_.close();
+    return;
+  }
+
+  constexpr auto kRecSize = static_cast<uint32_t>(sizeof(LatencyRecord));
+  constexpr std::array<char, 12> kHeader{
+      'C', 'P', 'P', 'B', 'L', 'A', 'T', '1',  //
+      static_cast<char>(kRecSize & 0xFFU), static_cast<char>((kRecSize >> 8U) & 0xFFU),
+      static_cast<char>((kRecSize >> 16U) & 0xFFU), static_cast<char>(kRecSize >> 24U)};
+  ofs_.write(kHeader.data(), kHeader.size());
+  buf_ = std::make_unique<LatencyRecord[]>(kBufferedNum);
+}
+
+LatencyLog::~LatencyLog()
+{
+  if (writer_.joinable()) {
+    Stop();
+  }
+}
+
+void
+LatencyLog::Start(  //
+    const size_t thread_num)
+{
+  rings_ = std::make_unique<LatencyRing[]>(thread_num);
+  ring_num_ = thread_num;
+  written_num_ = 0;
+  dropped_num_ = 0;
+  is_running_.store(true, std::memory_order_relaxed);
+  writer_ = std::thread{&LatencyLog::WriteRecords, this};
+}
+
+void
+LatencyLog::Stop()
+{
+  is_running_.store(false, std::memory_order_relaxed);
+  writer_.join();
+
+  while (Drain() > 0) {
+    // write remaining records
+  }
+  FlushBuffer();
+  ofs_.flush();
+  for (size_t i = 0; i < ring_num_; ++i) {
+    dropped_num_ += rings_[i].GetDroppedNum();
+  }
+  rings_.reset();
+  ring_num_ = 0;
+}
+
+void
+LatencyLog::WriteRecords()
+{
+  while (is_running_.load(std::memory_order_relaxed)) {
+    if (Drain() == 0) {
+      std::this_thread::sleep_for(kIdleInterval);
+    }
+  }
+}
+
+auto
+LatencyLog::Drain()  //
+    -> size_t
+{
+  size_t total = 0;
+  for (size_t i = 0; i < ring_num_; ++i) {
+    const auto num = rings_[i].Pop(&buf_[buf_num_], kBufferedNum - buf_num_);
+    buf_num_ += num;
+    total += num;
+    if (buf_num_ == kBufferedNum) {
+      FlushBuffer();
+    }
+  }
+  return total;
+}
+
+void
+LatencyLog::FlushBuffer()
+{
+  if (buf_num_ == 0) return;
+
+  ofs_.write(reinterpret_cast<const char *>(buf_.get()),  // NOLINT
+             static_cast<std::streamsize>(buf_num_ * sizeof(LatencyRecord)));
+  written_num_ += buf_num_;
+  buf_num_ = 0;
+}
+
+}  // namespace dbgroup::benchmark::component
@@ -18,20 +18,81 @@
 #include "dbgroup/benchmark/component/measurements.hpp"
 
 // C++ standard libraries
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <istream>
+#include <map>
+#include <optional>
+#include <ostream>
+#include <string_view>
 
 namespace dbgroup::benchmark::component
 {
+namespace
+{
+/*############################################################################*
+ * Local constants
+ *############################################################################*/
+
+/// @brief The magic of serialized sketches.
+constexpr std::string_view kMagic = "CPPBSKT1";
+
+/// @brief The maximum number of operations accepted from serialized sketches.
+constexpr size_t kMaxOPsNum = 1UL << 16UL;
+
+/*############################################################################*
+ * Local utilities
+ *############################################################################*/
+
+/**
+ * @brief Write a trivially copyable value in the native byte order.
+ *
+ * @tparam T A value type.
+ * @param os An output stream.
+ * @param val A value to be written.
+ */
+template <class T>
+void
+WriteValue(  //
+    std::ostream &os,
+    const T &val)
+{
+  os.write(reinterpret_cast<const char *>(&val), sizeof(T));  // NOLINT
+}
+
+/**
+ * @brief Read a trivially copyable value in the native byte order.
+ *
+ * @tparam T A value type.
+ * @param is An input stream.
+ * @param val A read value.
+ * @retval true if the value is read.
+ * @retval false otherwise.
+ */
+template <class T>
+auto
+ReadValue(  //
+    std::istream &is,
+    T &val)  //
+    -> bool
+{
+  return static_cast<bool>(is.read(reinterpret_cast<char *>(&val), sizeof(T)));  // NOLINT
+}
+
+}  // namespace
 
 SimpleDDSketch::SimpleDDSketch(  //
     const size_t ops_num)
     : min_(ops_num, ~0UL),
       max_(ops_num, 0UL),
       exec_nums_(ops_num, 0UL),
-      bins_(ops_num, std::array<uint32_t, kBinNum>{})
+      sums_(ops_num, 0UL),
+      moments_(ops_num),
+      bins_(ops_num, std::array<uint32_t, kBinNum>{}),
+      spills_(ops_num)
 {
 }
 
@@ -42,44 +103,86 @@ SimpleDDSketch::operator+=(  //
   total_exec_num_ += rhs.total_exec_num_;
   total_exec_time_nano_ += rhs.total_exec_time_nano_;
 
-  const auto ops_num = bins_.size();
+  const auto ops_num = std::min(bins_.size(), rhs.bins_.size());
   for (size_t ops_id = 0; ops_id < ops_num; ++ops_id) {
+    if (rhs.min_[ops_id] < min_[ops_id]) {
+      min_[ops_id] = rhs.min_[ops_id];
+    }
+    if (rhs.max_[ops_id] > max_[ops_id]) {
+      max_[ops_id] = rhs.max_[ops_id];
+    }
+    if (exec_nums_[ops_id] == 0) {
+      moments_[ops_id] = rhs.moments_[ops_id];
+    } else if (rhs.exec_nums_[ops_id] > 0) {
+      // shift the power sums of rhs to the shift of this sketch
+      auto &[shift, s2, s3] = moments_[ops_id];
+      const auto &[shift_b, s2_b, s3_b] = rhs.moments_[ops_id];
+      const auto n_b = static_cast<double>(rhs.exec_nums_[ops_id]);
+      const auto s1_b = rhs.GetShiftedSum(ops_id);
+      const auto delta = static_cast<double>(static_cast<int64_t>(shift_b - shift));
+      s3 += s3_b + 3.0 * delta * s2_b + 3.0 * delta * delta * s1_b + n_b * delta * delta * delta;
+      s2 += s2_b + 2.0 * delta * s1_b + n_b * delta * delta;
+    }
+
+    sums_[ops_id] += rhs.sums_[ops_id];
     exec_nums_[ops_id] += rhs.exec_nums_[ops_id];
     for (size_t i = 0; i < kBinNum; ++i) {
-      bins_[ops_id][i] += rhs.bins_[ops_id][i];
+      auto &bin = bins_[ops_id][i];
+      const auto sum = static_cast<size_t>(bin) + rhs.bins_[ops_id][i];
+      bin = static_cast<uint32_t>(sum);
+      if (sum != bin) [[unlikely]] {
+        AddToSpill(ops_id, i, sum - bin);
+      }
+    }
+    for (const auto &[pos, cnt] : rhs.spills_[ops_id]) {
+      AddToSpill(ops_id, pos, cnt);
     }
   }
 }
 
-void
-SimpleDDSketch::Add(  //
+auto
+SimpleDDSketch::HasLatency(     //
+    const size_t ops_id) const  //
+    -> bool
+{
+  return exec_nums_.at(ops_id) > 0;
+}
+
+auto
+SimpleDDSketch::GetExecNum(     //
+    const size_t ops_id) const  //
+    -> size_t
+{
+  return exec_nums_.at(ops_id);
+}
+
+auto
+SimpleDDSketch::GetBinCount(  //
     const size_t ops_id,
-    const size_t cnt,
-    const size_t lat)
+    const size_t pos) const  //
+    -> size_t
 {
-  total_exec_num_ += cnt;
-  total_exec_time_nano_ += lat;
+  const auto &spills = spills_[ops_id];
+  if (spills.empty()) return bins_[ops_id][pos];
 
-  auto &min = min_[ops_id];
-  if (lat < min) [[unlikely]] {
-    min = lat;
-  }
-  auto &max = max_[ops_id];
-  if (lat > max) [[unlikely]] {
-    max = lat;
-  }
+  const auto it = spills.find(pos);
+  return bins_[ops_id][pos] + ((it == spills.end()) ? 0 : it->second);
+}
 
-  const auto pos = (lat == 0) ? 0 : static_cast<size_t>(std::ceil(std::log(lat) / denom_));
-  ++bins_[ops_id][pos];
-  ++exec_nums_[ops_id];
+auto
+SimpleDDSketch::GetBinValue(  //
+    const size_t pos)         //
+    -> size_t
+{
+  return static_cast<size_t>(2 * std::pow(kGamma, pos) / (kGamma + 1));
 }
 
 auto
-SimpleDDSketch::HasLatency(     //
-    const size_t ops_id) const  //
-    -> bool
+SimpleDDSketch::GetBinUpperBound(  //
+    const size_t pos)              //
+    -> size_t
 {
-  return exec_nums_.at(ops_id) > 0;
+  return static_cast<size_t>(std::pow(kGamma, pos));
 }
 
 auto
@@ -92,12 +195,174 @@ SimpleDDSketch::Quantile(  //
   if (q >= 1.0) return max_[ops_id];
 
   const auto bound = static_cast<size_t>(q * static_cast<double>(exec_nums_[ops_id] - 1));
-  size_t cnt = bins_[ops_id][0];
+  size_t cnt = GetBinCount(ops_id, 0);
   size_t i = 0;
   while (i < kBinNum - 1 && cnt <= bound) {
-    cnt += bins_[ops_id][++i];
+    cnt += GetBinCount(ops_id, ++i);
+  }
+  return GetBinValue(i);
+}
+
+auto
+SimpleDDSketch::GetTotalTime(   //
+    const size_t ops_id) const  //
+    -> size_t
+{
+  return sums_.at(ops_id);
+}
+
+auto
+SimpleDDSketch::GetMean(        //
+    const size_t ops_id) const  //
+    -> double
+{
+  return GetCentralMoments(ops_id).mean;
+}
+
+auto
+SimpleDDSketch::GetVariance(    //
+    const size_t ops_id) const  //
+    -> double
+{
+  const auto n = exec_nums_.at(ops_id);
+  return (n > 1) ? GetCentralMoments(ops_id).m2 / static_cast<double>(n - 1) : 0.0;
+}
+
+auto
+SimpleDDSketch::GetStdDev(      //
+    const size_t ops_id) const  //
+    -> double
+{
+  return std::sqrt(GetVariance(ops_id));
+}
+
+auto
+SimpleDDSketch::GetSkewness(    //
+    const size_t ops_id) const  //
+    -> double
+{
+  const auto &[mean, m2, m3] = GetCentralMoments(ops_id);
+  if (m2 <= 0) return 0.0;
+  return std::sqrt(static_cast<double>(exec_nums_[ops_id])) * m3 / std::pow(m2, 1.5);  // NOLINT
+}
+
+void
+SimpleDDSketch::Serialize(  //
+    std::ostream &os) const
+{
+  os.write(kMagic.data(), static_cast<std::streamsize>(kMagic.size()));
+  WriteValue(os, exec_nums_.size());
+  WriteValue(os, total_exec_num_);
+  WriteValue(os, total_exec_time_nano_);
+  for (size_t ops_id = 0; ops_id < exec_nums_.size(); ++ops_id) {
+    WriteValue(os, min_[ops_id]);
+    WriteValue(os, max_[ops_id]);
+    WriteValue(os, exec_nums_[ops_id]);
+    WriteValue(os, sums_[ops_id]);
+    WriteValue(os, GetCentralMoments(ops_id));
+
+    size_t bin_num = 0;
+    for (size_t pos = 0; pos < kBinNum; ++pos) {
+      bin_num += (GetBinCount(ops_id, pos) > 0) ? 1 : 0;
+    }
+    WriteValue(os, bin_num);
+    for (size_t pos = 0; pos < kBinNum; ++pos) {
+      const auto cnt = static_cast<uint64_t>(GetBinCount(ops_id, pos));
+      if (cnt == 0) continue;
+      WriteValue(os, static_cast<uint32_t>(pos));
+      WriteValue(os, cnt);
+    }
+  }
+}
+
+auto
+SimpleDDSketch::Deserialize(  //
+    std::istream &is)         //
+    -> std::optional<SimpleDDSketch>
+{
+  std::array<char, kMagic.size()> magic{};
+  if (!is.read(magic.data(), magic.size())
+      || std::string_view{magic.data(), magic.size()} != kMagic) {
+    return std::nullopt;
+  }
+
+  size_t ops_num = 0;
+  if (!ReadValue(is, ops_num) || ops_num > kMaxOPsNum) return std::nullopt;
+  SimpleDDSketch sketch{ops_num};
+  if (!ReadValue(is, sketch.total_exec_num_) || !ReadValue(is, sketch.total_exec_time_nano_)) {
+    return std::nullopt;
+  }
+  for (size_t ops_id = 0; ops_id < ops_num; ++ops_id) {
+    size_t bin_num = 0;
+    CentralMoments central{};
+    if (!ReadValue(is, sketch.min_[ops_id]) || !ReadValue(is, sketch.max_[ops_id])
+        || !ReadValue(is, sketch.exec_nums_[ops_id]) || !ReadValue(is, sketch.sums_[ops_id])
+        || !ReadValue(is, central) || !ReadValue(is, bin_num) || bin_num > kBinNum) {
+      return std::nullopt;
+    }
+    const auto n = sketch.exec_nums_[ops_id];
+    if (n > 0) {
+      // convert central moments to power sums around the truncated mean
+      auto &[shift, s2, s3] = sketch.moments_[ops_id];
+      shift = sketch.sums_[ops_id] / n;
+      const auto e = sketch.GetShiftedSum(ops_id) / static_cast<double>(n);
+      s2 = central.m2 + static_cast<double>(n) * e * e;
+      s3 = central.m3 + 3.0 * e * central.m2 + static_cast<double>(n) * e * e * e;
+    }
+    for (size_t i = 0; i < bin_num; ++i) {
+      uint32_t pos = 0;
+      uint64_t cnt = 0;
+      if (!ReadValue(is, pos) || !ReadValue(is, cnt) || pos >= kBinNum) return std::nullopt;
+      sketch.SetBinCount(ops_id, pos, cnt);
+    }
+  }
+  return sketch;
+}
+
+auto
+SimpleDDSketch::GetShiftedSum(  //
+    const size_t ops_id) const    //
+    -> double
+{
+  const auto n = exec_nums_[ops_id];
+  return static_cast<double>(static_cast<int64_t>(sums_[ops_id] - n * moments_[ops_id].shift));
+}
+
+auto
+SimpleDDSketch::GetCentralMoments(  //
+    const size_t ops_id) const        //
+    -> CentralMoments
+{
+  const auto n = static_cast<double>(exec_nums_.at(ops_id));
+  if (n <= 0) return {};
+
+  const auto &[shift, s2, s3] = moments_[ops_id];
+  const auto s1 = GetShiftedSum(ops_id);
+  const auto d = s1 / n;
+  return {static_cast<double>(shift) + d, std::max(s2 - s1 * d, 0.0),
+          s3 - 3.0 * d * s2 + 2.0 * s1 * d * d};
+}
+
+void
+SimpleDDSketch::AddToSpill(  //
+    const size_t ops_id,
+    const size_t pos,
+    const size_t cnt)
+{
+  spills_[ops_id][pos] += cnt;
+}
+
+void
+SimpleDDSketch::SetBinCount(  //
+    const size_t ops_id,
+    const size_t pos,
+    const size_t cnt)
+{
+  const auto low = static_cast<uint32_t>(cnt);
+  bins_[ops_id][pos] = low;
+  if (cnt > low) {
+    AddToSpill(ops_id, pos, cnt - low);
   }
-  return static_cast<size_t>(2 * std::pow(kGamma, i) / (kGamma + 1));
 }
 
 }  // namespace dbgroup::benchmark::component
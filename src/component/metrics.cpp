@@ -0,0 +1,151 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// the corresponding header
+#include "dbgroup/benchmark/component/metrics.hpp"
+
+// C++ standard libraries
+#include <algorithm>
+#include <cstddef>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// local sources
+#include "dbgroup/benchmark/component/measurements.hpp"
+
+namespace dbgroup::benchmark::component
+{
+/*############################################################################*
+ * MetricsRegistry
+ *############################################################################*/
+
+MetricsRegistry::MetricsRegistry()
+    : counters_(Metrics::GetCounterNames().size(), 0),
+      hist_num_{Metrics::GetHistogramNames().size()},
+      histograms_{hist_num_}
+{
+}
+
+auto
+MetricsRegistry::operator+=(  //
+    const MetricsRegistry &rhs)  //
+    -> MetricsRegistry &
+{
+  if (counters_.size() < rhs.counters_.size()) {
+    counters_.resize(rhs.counters_.size(), 0);
+  }
+  for (size_t id = 0; id < rhs.counters_.size(); ++id) {
+    counters_[id] += rhs.counters_[id];
+  }
+
+  if (hist_num_ < rhs.hist_num_) {
+    // histograms have been registered after this registry was created
+    SimpleDDSketch histograms{rhs.hist_num_};
+    histograms += histograms_;
+    histograms_ = std::move(histograms);
+    hist_num_ = rhs.hist_num_;
+  }
+  histograms_ += rhs.histograms_;
+  return *this;
+}
+
+void
+MetricsRegistry::Report(  //
+    std::ostream &os,
+    const bool as_csv) const
+{
+  const auto &counter_names = Metrics::GetCounterNames();
+  const auto &hist_names = Metrics::GetHistogramNames();
+  if (as_csv) {
+    os << "metric,count,p50,p99,max\n";
+  }
+
+  for (size_t id = 0; id < counters_.size() && id < counter_names.size(); ++id) {
+    if (as_csv) {
+      os << counter_names[id] << "," << counters_[id] << ",,,\n";
+    } else {
+      os << "  " << counter_names[id] << ": " << counters_[id] << "\n";
+    }
+  }
+  for (size_t id = 0; id < hist_num_ && id < hist_names.size(); ++id) {
+    const auto cnt = histograms_.GetExecNum(id);
+    const auto has_values = histograms_.HasLatency(id);
+    const auto p50 = has_values ? histograms_.Quantile(id, 0.5) : 0;   // NOLINT
+    const auto p99 = has_values ? histograms_.Quantile(id, 0.99) : 0;  // NOLINT
+    const auto max = has_values ? histograms_.Quantile(id, 1.0) : 0;
+    if (as_csv) {
+      os << hist_names[id] << "," << cnt << "," << p50 << "," << p99 << "," << max << "\n";
+    } else {
+      os << "  " << hist_names[id] << ": " << cnt << ", " << p50 << "/" << p99 << "/" << max
+         << "\n";
+    }
+  }
+}
+
+/*############################################################################*
+ * Metrics
+ *############################################################################*/
+
+auto
+Metrics::RegisterCounter(  //
+    const std::string &name)  //
+    -> size_t
+{
+  return Register(counter_names_, name);
+}
+
+auto
+Metrics::RegisterHistogram(  //
+    const std::string &name)  //
+    -> size_t
+{
+  return Register(hist_names_, name);
+}
+
+auto
+Metrics::GetCounterNames()  //
+    -> std::vector<std::string>
+{
+  const std::lock_guard guard{mtx_};
+  return counter_names_;
+}
+
+auto
+Metrics::GetHistogramNames()  //
+    -> std::vector<std::string>
+{
+  const std::lock_guard guard{mtx_};
+  return hist_names_;
+}
+
+auto
+Metrics::Register(  //
+    std::vector<std::string> &names,
+    const std::string &name)  //
+    -> size_t
+{
+  const std::lock_guard guard{mtx_};
+  const auto it = std::find(names.begin(), names.end(), name);
+  if (it != names.end()) return static_cast<size_t>(it - names.begin());
+
+  names.emplace_back(name);
+  return names.size() - 1;
+}
+
+}  // namespace dbgroup::benchmark::component
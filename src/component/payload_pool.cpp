@@ -0,0 +1,42 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// the corresponding header
+#include "dbgroup/benchmark/component/payload_pool.hpp"
+
+// C++ standard libraries
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <random>
+
+namespace dbgroup::benchmark::component
+{
+PayloadPool::PayloadPool(  //
+    const size_t size,
+    const size_t rand_seed)
+    : buf_{std::make_unique_for_overwrite<std::byte[]>(size)}, size_{size}
+{
+  std::mt19937_64 rand{rand_seed};
+  for (size_t pos = 0; pos < size_; pos += sizeof(uint64_t)) {
+    const auto val = rand();
+    std::memcpy(buf_.get() + pos, &val, std::min(sizeof(uint64_t), size_ - pos));
+  }
+}
+
+}  // namespace dbgroup::benchmark::component
@@ -0,0 +1,168 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// the corresponding header
+#include "dbgroup/benchmark/component/scalability.hpp"
+
+// C++ standard libraries
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace dbgroup::benchmark::component
+{
+namespace
+{
+/*############################################################################*
+ * Local constants
+ *############################################################################*/
+
+/// @brief The number of coefficients in the linearized USL.
+constexpr size_t kCoefNum = 3;
+
+/// @brief A threshold for detecting singular matrices.
+constexpr double kEpsilon = 1e-12;
+
+/*############################################################################*
+ * Local utilities
+ *############################################################################*/
+
+/**
+ * @brief Solve the least squares problem using only masked coefficients.
+ *
+ * @param mask Coefficients to be fitted.
+ * @param xs Explanatory variables for each measurement.
+ * @param ys Objective variables for each measurement.
+ * @param coef Fitted coefficients (unmasked ones are set to zero).
+ * @retval true if the coefficients are determined.
+ * @retval false otherwise.
+ */
+auto
+SolveLeastSquares(  //
+    const std::array<bool, kCoefNum> &mask,
+    const std::vector<std::array<double, kCoefNum>> &xs,
+    const std::vector<double> &ys,
+    std::array<double, kCoefNum> &coef)  //
+    -> bool
+{
+  std::array<size_t, kCoefNum> ids{};
+  size_t n = 0;
+  for (size_t i = 0; i < kCoefNum; ++i) {
+    if (mask[i]) {
+      ids[n++] = i;
+    }
+  }
+  if (n == 0 || xs.size() < n) return false;
+
+  // construct normal equations as an augmented matrix
+  std::array<std::array<double, kCoefNum + 1>, kCoefNum> mat{};
+  for (size_t k = 0; k < xs.size(); ++k) {
+    for (size_t i = 0; i < n; ++i) {
+      for (size_t j = 0; j < n; ++j) {
+        mat[i][j] += xs[k][ids[i]] * xs[k][ids[j]];
+      }
+      mat[i][n] += xs[k][ids[i]] * ys[k];
+    }
+  }
+
+  // solve them by Gaussian elimination with partial pivoting
+  for (size_t i = 0; i < n; ++i) {
+    auto pivot = i;
+    for (size_t j = i + 1; j < n; ++j) {
+      if (std::abs(mat[j][i]) > std::abs(mat[pivot][i])) {
+        pivot = j;
+      }
+    }
+    if (std::abs(mat[pivot][i]) < kEpsilon) return false;
+    std::swap(mat[i], mat[pivot]);
+
+    for (size_t j = 0; j < n; ++j) {
+      if (j == i) continue;
+      const auto ratio = mat[j][i] / mat[i][i];
+      for (size_t k = i; k <= n; ++k) {
+        mat[j][k] -= ratio * mat[i][k];
+      }
+    }
+  }
+
+  coef = {};
+  for (size_t i = 0; i < n; ++i) {
+    coef[ids[i]] = mat[i][n] / mat[i][i];
+  }
+  return true;
+}
+
+}  // namespace
+
+ScalabilityModel::ScalabilityModel(  //
+    const Type type,
+    const std::vector<size_t> &thread_nums,
+    const std::vector<double> &throughputs)
+{
+  // linearize the model: N / X(N) = a + b * (N - 1) + c * N * (N - 1)
+  std::vector<std::array<double, kCoefNum>> xs{};
+  std::vector<double> ys{};
+  for (size_t i = 0; i < thread_nums.size() && i < throughputs.size(); ++i) {
+    const auto n = static_cast<double>(thread_nums[i]);
+    if (n <= 0 || throughputs[i] <= 0) continue;
+    xs.emplace_back(std::array<double, kCoefNum>{1.0, n - 1.0, n * (n - 1.0)});
+    ys.emplace_back(n / throughputs[i]);
+  }
+
+  // try simpler models if coefficients cannot be determined or are negative
+  constexpr std::array<std::array<bool, kCoefNum>, 4> kCandidates{{
+      {true, true, true},
+      {true, true, false},
+      {true, false, true},
+      {true, false, false},
+  }};
+  for (const auto &mask : kCandidates) {
+    if (type == kAmdahl && mask[2]) continue;
+
+    std::array<double, kCoefNum> coef{};
+    if (!SolveLeastSquares(mask, xs, ys, coef)) continue;
+    if (coef[0] <= 0 || coef[1] < 0 || coef[2] < 0) continue;
+
+    lambda_ = 1.0 / coef[0];
+    sigma_ = coef[1] / coef[0];
+    kappa_ = coef[2] / coef[0];
+    return;
+  }
+}
+
+auto
+ScalabilityModel::Predict(  //
+    const size_t thread_num) const  //
+    -> double
+{
+  const auto n = static_cast<double>(thread_num);
+  return lambda_ * n / (1.0 + sigma_ * (n - 1.0) + kappa_ * n * (n - 1.0));
+}
+
+auto
+ScalabilityModel::GetPeakThreadNum() const  //
+    -> size_t
+{
+  if (kappa_ <= 0) return 0;
+  if (sigma_ >= 1.0) return 1;
+
+  const auto peak = static_cast<size_t>(std::round(std::sqrt((1.0 - sigma_) / kappa_)));
+  return (peak > 0) ? peak : 1;
+}
+
+}  // namespace dbgroup::benchmark::component
@@ -0,0 +1,57 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// the corresponding header
+#include "dbgroup/benchmark/component/signal_handler.hpp"
+
+// C++ standard libraries
+#include <atomic>
+#include <csignal>
+
+namespace dbgroup::benchmark::component
+{
+
+SignalHandler::SignalHandler()
+{
+  interrupted_.store(false, std::memory_order_relaxed);
+  old_int_handler_ = std::signal(SIGINT, HandleSignal);
+  old_term_handler_ = std::signal(SIGTERM, HandleSignal);
+}
+
+SignalHandler::~SignalHandler()
+{
+  std::signal(SIGINT, old_int_handler_);
+  std::signal(SIGTERM, old_term_handler_);
+}
+
+auto
+SignalHandler::IsInterrupted()  //
+    -> bool
+{
+  return interrupted_.load(std::memory_order_relaxed);
+}
+
+void
+SignalHandler::HandleSignal(  //
+    const int sig)
+{
+  if (interrupted_.exchange(true, std::memory_order_relaxed)) {
+    std::signal(sig, SIG_DFL);
+    std::raise(sig);
+  }
+}
+
+}  // namespace dbgroup::benchmark::component
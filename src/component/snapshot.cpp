@@ -0,0 +1,128 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// the corresponding header
+#include "dbgroup/benchmark/component/snapshot.hpp"
+
+// C++ standard libraries
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// local sources
+#include "dbgroup/benchmark/component/measurements.hpp"
+
+namespace dbgroup::benchmark::component
+{
+/*############################################################################*
+ * SnapshotSketch
+ *############################################################################*/
+
+SnapshotSketch::SnapshotSketch(  //
+    const size_t ops_num)
+    : bufs_{SimpleDDSketch{ops_num}, SimpleDDSketch{ops_num}}
+{
+}
+
+auto
+SnapshotSketch::Publish()  //
+    -> SimpleDDSketch &
+{
+  // the reporter has finished reading the retired buffer before this request
+  epoch_ = requested_.load(std::memory_order_acquire);
+  const auto next = active_ ^ 1UL;
+  bufs_[next] = bufs_[active_];
+  retired_ = active_;
+  active_ = next;
+  if (has_base_) {
+    bufs_[retired_] += base_;
+  }
+  acked_.store(epoch_, std::memory_order_release);
+  return bufs_[active_];
+}
+
+auto
+SnapshotSketch::Finish()  //
+    -> SimpleDDSketch
+{
+  is_finished_.store(true, std::memory_order_release);
+  return std::move(bufs_[active_]);
+}
+
+void
+SnapshotSketch::Restart(  //
+    const SimpleDDSketch &base)
+{
+  base_ = base;
+  has_base_ = true;
+  bufs_[active_] = SimpleDDSketch{base.GetOPsNum()};
+  is_finished_.store(false, std::memory_order_release);
+}
+
+/*############################################################################*
+ * SnapshotCollector
+ *############################################################################*/
+
+void
+SnapshotCollector::Start(  //
+    const size_t thread_num,
+    const size_t ops_num)
+{
+  sketches_.clear();
+  sketches_.reserve(thread_num);
+  for (size_t i = 0; i < thread_num; ++i) {
+    sketches_.emplace_back(std::make_unique<SnapshotSketch>(ops_num));
+  }
+  latest_.assign(thread_num, SimpleDDSketch{ops_num});
+  total_ = SimpleDDSketch{ops_num};
+  ops_num_ = ops_num;
+  epoch_ = 0;
+}
+
+auto
+SnapshotCollector::Collect()  //
+    -> const SimpleDDSketch &
+{
+  ++epoch_;
+  for (const auto &sketch : sketches_) {
+    sketch->Request(epoch_);
+  }
+
+  const auto &deadline = std::chrono::steady_clock::now() + kMaxWait;
+  for (size_t i = 0; i < latest_.size(); ++i) {
+    const auto &sketch = *sketches_[i];
+    const SimpleDDSketch *snapshot = nullptr;
+    while ((snapshot = sketch.GetSnapshot(epoch_)) == nullptr && !sketch.IsFinished()
+           && std::chrono::steady_clock::now() < deadline) {
+      std::this_thread::yield();
+    }
+    if (snapshot != nullptr) {
+      latest_[i] = *snapshot;
+    }
+  }
+
+  total_ = SimpleDDSketch{ops_num_};
+  for (const auto &snapshot : latest_) {
+    total_ += snapshot;
+  }
+  return total_;
+}
+
+}  // namespace dbgroup::benchmark::component
@@ -0,0 +1,267 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// the corresponding header
+#include "dbgroup/benchmark/component/soak_recorder.hpp"
+
+// C++ standard libraries
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <utility>
+
+// system libraries
+#include <unistd.h>
+
+// local sources
+#include "dbgroup/benchmark/component/measurements.hpp"
+
+namespace dbgroup::benchmark::component
+{
+namespace
+{
+/*############################################################################*
+ * Local constants
+ *############################################################################*/
+
+/// @brief A threshold for detecting singular regressions.
+constexpr double kEpsilon = 1e-12;
+
+/*############################################################################*
+ * Local utilities
+ *############################################################################*/
+
+/**
+ * @return The resident set size of this process [bytes] (zero if unknown).
+ */
+auto
+ReadRSS()  //
+    -> size_t
+{
+  std::ifstream ifs{"/proc/self/statm"};
+  size_t total_pages = 0;
+  size_t resident_pages = 0;
+  if (!(ifs >> total_pages >> resident_pages)) return 0;
+
+  const auto page_size = sysconf(_SC_PAGESIZE);
+  return (page_size > 0) ? resident_pages * static_cast<size_t>(page_size) : 0;
+}
+
+}  // namespace
+
+/*############################################################################*
+ * LinearTrend
+ *############################################################################*/
+
+void
+LinearTrend::Add(  //
+    const double x,
+    const double y)
+{
+  ++n_;
+  sum_x_ += x;
+  sum_y_ += y;
+  sum_xx_ += x * x;
+  sum_xy_ += x * y;
+}
+
+auto
+LinearTrend::GetSlope() const  //
+    -> double
+{
+  const auto n = static_cast<double>(n_);
+  const auto denom = n * sum_xx_ - sum_x_ * sum_x_;
+  if (n_ < 2 || denom < kEpsilon) return 0.0;
+  return (n * sum_xy_ - sum_x_ * sum_y_) / denom;
+}
+
+auto
+LinearTrend::Predict(  //
+    const double x) const  //
+    -> double
+{
+  if (n_ == 0) return 0.0;
+
+  const auto slope = GetSlope();
+  return (sum_y_ - slope * sum_x_) / static_cast<double>(n_) + slope * x;
+}
+
+/*############################################################################*
+ * SoakRecorder
+ *############################################################################*/
+
+SoakRecorder::SoakRecorder(  //
+    const size_t thread_num,
+    const size_t ops_num,
+    const size_t window_nano,
+    const std::string &log_path,
+    HdrLogWriter *hdr_log,
+    HeatmapWriter *heatmap)
+    : ops_num_{ops_num},
+      window_nano_{window_nano},
+      hdr_log_{hdr_log},
+      heatmap_{heatmap},
+      finished_nums_(thread_num, 0),
+      total_{ops_num},
+      latency_trends_(ops_num)
+{
+  if (!log_path.empty()) {
+    log_.open(log_path);
+    if (log_) {
+      log_ << "window,elapsed_sec,throughput,rss_bytes,ops_id,exec_num,p50,p99,p999,max\n";
+    } else {
+      std::cerr << "WARNING: failed to open '" << log_path << "', so windows are not logged.\n";
+    }
+  }
+  writer_ = std::thread{&SoakRecorder::WriteWindows, this};
+}
+
+SoakRecorder::~SoakRecorder()
+{
+  if (writer_.joinable()) {
+    Finish(0);
+  }
+}
+
+void
+SoakRecorder::Submit(  //
+    const size_t thread_id,
+    const size_t window_id,
+    SimpleDDSketch &&sketch)
+{
+  {
+    const std::lock_guard lock{mtx_};
+    queue_.emplace_back(Entry{thread_id, window_id, std::move(sketch)});
+  }
+  cond_.notify_one();
+}
+
+void
+SoakRecorder::Finish(  //
+    const size_t elapsed_nano)
+{
+  {
+    const std::lock_guard lock{mtx_};
+    elapsed_nano_ = elapsed_nano;
+    finished_ = true;
+  }
+  cond_.notify_one();
+  writer_.join();
+}
+
+void
+SoakRecorder::WriteWindows()
+{
+  std::deque<Entry> entries{};
+  for (auto finished = false; !finished;) {
+    {
+      std::unique_lock lock{mtx_};
+      cond_.wait(lock, [this] { return !queue_.empty() || finished_; });
+      entries.swap(queue_);
+      finished = finished_;
+    }
+
+    // merge submitted sketches into pending windows
+    for (auto &&[thread_id, window_id, sketch] : entries) {
+      if (auto &&[it, inserted] = pending_.try_emplace(window_id, std::move(sketch)); !inserted) {
+        it->second += sketch;
+      }
+      finished_nums_[thread_id] = window_id + 1;
+    }
+    entries.clear();
+
+    // flush windows that all the workers have finished
+    auto end = *std::min_element(finished_nums_.begin(), finished_nums_.end());
+    if (finished && !pending_.empty()) {
+      end = std::max(end, pending_.rbegin()->first + 1);
+    }
+    for (; next_window_ < end; ++next_window_) {
+      auto window = window_nano_;
+      const auto begin = next_window_ * window_nano_;
+      if (finished && elapsed_nano_ > begin && elapsed_nano_ - begin < window_nano_) {
+        window = elapsed_nano_ - begin;  // the last partial window
+      }
+
+      const auto it = pending_.find(next_window_);
+      if (it == pending_.end()) {
+        Flush(SimpleDDSketch{ops_num_}, window);
+      } else {
+        Flush(it->second, window);
+        pending_.erase(it);
+      }
+    }
+  }
+}
+
+void
+SoakRecorder::Flush(  //
+    const SimpleDDSketch &sketch,
+    const size_t window_nano)
+{
+  const auto x = static_cast<double>(next_window_);
+  const auto elapsed = static_cast<double>(next_window_ * window_nano_ + window_nano) / 1E9;
+  const auto throughput = static_cast<double>(sketch.GetTotalExecNum())
+                          / (static_cast<double>(window_nano) / 1E9);
+  const auto rss = ReadRSS();
+  throughput_trend_.Add(x, throughput);
+  if (window_nano == window_nano_) {  // a truncated last window is too noisy
+    // keep a uniform sample of windows by reservoir sampling
+    ++full_window_num_;
+    if (throughputs_.size() < kMaxThroughputSampleNum) {
+      throughputs_.emplace_back(throughput);
+    } else if (const auto pos = sampler_() % full_window_num_; pos < kMaxThroughputSampleNum) {
+      throughputs_[pos] = throughput;
+    }
+  }
+  rss_trend_.Add(x, static_cast<double>(rss));
+  total_ += sketch;
+  const auto start_sec = static_cast<double>(next_window_ * window_nano_) / 1E9;
+  if (hdr_log_ != nullptr) {
+    hdr_log_->Write(sketch, start_sec, static_cast<double>(window_nano) / 1E9);
+  }
+  if (heatmap_ != nullptr) {
+    heatmap_->Write(sketch, next_window_, start_sec);
+  }
+
+  const auto &log_row = [&](const std::string &ops_stats) {
+    if (!log_) return;
+    log_ << next_window_ << "," << elapsed << "," << throughput << "," << rss << "," << ops_stats
+         << "\n";
+  };
+  auto has_latency = false;
+  for (size_t id = 0; id < ops_num_; ++id) {
+    if (!sketch.HasLatency(id)) continue;
+    has_latency = true;
+    latency_trends_[id].Add(x, static_cast<double>(sketch.Quantile(id, kTrendQuantile)));
+    log_row(std::to_string(id) + "," + std::to_string(sketch.GetExecNum(id)) + ","
+            + std::to_string(sketch.Quantile(id, 0.5)) + ","
+            + std::to_string(sketch.Quantile(id, kTrendQuantile)) + ","
+            + std::to_string(sketch.Quantile(id, 0.999)) + ","
+            + std::to_string(sketch.Quantile(id, 1.0)));
+  }
+  if (!has_latency) {
+    log_row(",0,,,,");
+  }
+  if (log_) {
+    log_.flush();
+  }
+}
+
+}  // namespace dbgroup::benchmark::component
@@ -0,0 +1,60 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// the corresponding header
+#include "dbgroup/benchmark/component/stability.hpp"
+
+// C++ standard libraries
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace dbgroup::benchmark::component
+{
+
+ThroughputStability::ThroughputStability(  //
+    const std::vector<double> &throughputs,
+    const double threshold)
+    : window_num_{throughputs.size()}, threshold_{threshold}
+{
+  if (window_num_ == 0) return;
+
+  auto sorted = throughputs;
+  std::sort(sorted.begin(), sorted.end());
+  min_ = sorted.front();
+  max_ = sorted.back();
+  const auto mid = window_num_ / 2;
+  median_ = (window_num_ % 2 == 0) ? (sorted[mid - 1] + sorted[mid]) / 2.0 : sorted[mid];
+
+  const auto n = static_cast<double>(window_num_);
+  for (const auto x : sorted) {
+    mean_ += x;
+  }
+  mean_ /= n;
+  if (window_num_ > 1 && mean_ > 0) {
+    auto ss = 0.0;
+    for (const auto x : sorted) {
+      ss += (x - mean_) * (x - mean_);
+    }
+    cv_ = std::sqrt(ss / (n - 1.0)) / mean_;
+  }
+
+  const auto bound = std::lower_bound(sorted.begin(), sorted.end(), median_ * threshold_);
+  slow_fraction_ = static_cast<double>(bound - sorted.begin()) / n;
+}
+
+}  // namespace dbgroup::benchmark::component
@@ -0,0 +1,65 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// the corresponding header
+#include "dbgroup/benchmark/component/steady_state.hpp"
+
+// C++ standard libraries
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <vector>
+
+namespace dbgroup::benchmark::component
+{
+
+auto
+DetectSteadyState(  //
+    const std::vector<double> &series)  //
+    -> std::optional<size_t>
+{
+  const auto batch_num = series.size() / kMSERBatchSize;
+  if (batch_num < 2 * kMSERMinBatchNum) return std::nullopt;
+
+  std::vector<double> means(batch_num, 0.0);
+  for (size_t i = 0; i < batch_num * kMSERBatchSize; ++i) {
+    means[i / kMSERBatchSize] += series[i] / static_cast<double>(kMSERBatchSize);
+  }
+
+  // compute MSER statistics from the tail to reuse partial sums
+  size_t best_d = 0;
+  auto best_stat = std::numeric_limits<double>::max();
+  auto sum = 0.0;
+  auto sq_sum = 0.0;
+  for (size_t d = batch_num; d-- > 0;) {
+    sum += means[d];
+    sq_sum += means[d] * means[d];
+    if (batch_num - d < kMSERMinBatchNum) continue;
+
+    const auto n = static_cast<double>(batch_num - d);
+    const auto stat = (sq_sum - sum * sum / n) / (n * n);
+    if (stat <= best_stat) {
+      best_stat = stat;
+      best_d = d;
+    }
+  }
+
+  // a truncation point in the second half indicates a non-stationary series
+  if (2 * best_d >= batch_num) return std::nullopt;
+  return best_d * kMSERBatchSize;
+}
+
+}  // namespace dbgroup::benchmark::component
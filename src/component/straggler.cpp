@@ -0,0 +1,54 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// the corresponding header
+#include "dbgroup/benchmark/component/straggler.hpp"
+
+// C++ standard libraries
+#include <chrono>
+#include <thread>
+
+// local sources
+#include "dbgroup/benchmark/component/delay.hpp"
+
+namespace dbgroup::benchmark::component
+{
+
+void
+Straggler::Stall(  //
+    const StallModel &model)
+{
+  ++stall_num_;
+  switch (model.type) {
+    case StallModel::kSleep:
+      std::this_thread::sleep_for(std::chrono::nanoseconds{model.stall_nano});
+      break;
+    case StallModel::kYield: {
+      using Clock_t = std::chrono::high_resolution_clock;
+      const auto &deadline = Clock_t::now() + std::chrono::nanoseconds{model.stall_nano};
+      while (Clock_t::now() < deadline) {
+        std::this_thread::yield();
+      }
+      break;
+    }
+    case StallModel::kSpin:
+    default:
+      SpinDelay::Wait(model.stall_nano);
+      break;
+  }
+}
+
+}  // namespace dbgroup::benchmark::component
@@ -17,9 +17,17 @@
 #include "dbgroup/benchmark/benchmarker.hpp"
 
 // C++ standard libraries
+#include <chrono>
+#include <csignal>
 #include <cstddef>
+#include <filesystem>
+#include <fstream>
 #include <memory>
 #include <shared_mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
 
 // external sources
 #include "gtest/gtest.h"
@@ -51,6 +59,15 @@ class BenchmarkerFixture : public ::testing::Test
   static constexpr bool kThroughput = true;
   static constexpr bool kLatency = false;
   static constexpr size_t kThreadNum = DBGROUP_TEST_THREAD_NUM;
+  static constexpr size_t kShortTimeout = 1;
+  static constexpr size_t kLongTimeout = 60;
+  static constexpr size_t kMaxWarmUp = 2;
+  static constexpr size_t kSoakTimeout = 2;
+  static constexpr size_t kSoakWindow = 1;
+  static constexpr size_t kInterruptMilliSec = 100;
+  static constexpr size_t kSearchNum = 3;
+  static constexpr double kSLOQuantile = 0.99;
+  static constexpr size_t kSLOLatency = 100000;
 
   /*##########################################################################*
    * Setup/Teardown
@@ -82,6 +99,306 @@ class BenchmarkerFixture : public ::testing::Test
     benchmarker_->Run();
   }
 
+  void
+  VerifyCheckEnvironment()
+  {
+    Builder builder{target_, "Bench for testing", op_engine_};
+    builder.SetThreadNum(kThreadNum);
+    builder.SetRandomSeed(kRandomSeed);
+    builder.SetTimeOut(kShortTimeout);
+    builder.CheckEnvironment(false);
+
+    benchmarker_ = builder.Build();
+    benchmarker_->Run();
+  }
+
+  void
+  VerifyWarmUpDetection()
+  {
+    Builder builder{target_, "Bench for testing", op_engine_};
+    builder.SetThreadNum(kThreadNum);
+    builder.SetRandomSeed(kRandomSeed);
+    builder.SetTimeOut(kShortTimeout);
+    builder.DetectWarmUp(kMaxWarmUp);
+
+    benchmarker_ = builder.Build();
+    benchmarker_->Run();
+  }
+
+  void
+  VerifyRunSoakTest()
+  {
+    Builder builder{target_, "Bench for testing", op_engine_};
+    builder.SetThreadNum(kThreadNum);
+    builder.SetRandomSeed(kRandomSeed);
+    builder.SetTimeOut(kSoakTimeout);
+
+    const auto &tmp_dir = std::filesystem::temp_directory_path();
+    const auto &log_path = tmp_dir / "cpp_bench_soak_test.csv";
+    const auto &hdr_path = tmp_dir / "cpp_bench_soak_test.hlog";
+    builder.SetHdrHistogramLog(hdr_path.string());
+    benchmarker_ = builder.Build();
+    benchmarker_->RunSoakTest(kSoakWindow, log_path.string());
+
+    std::ifstream ifs{log_path};
+    size_t line_num = 0;
+    for (std::string line{}; std::getline(ifs, line);) {
+      ++line_num;
+    }
+    EXPECT_GT(line_num, kSoakTimeout / kSoakWindow);
+    std::filesystem::remove(log_path);
+
+    std::ifstream hdr_ifs{hdr_path};
+    size_t interval_num = 0;
+    for (std::string line{}; std::getline(hdr_ifs, line);) {
+      if (line.starts_with("Tag=")) {
+        ++interval_num;
+      }
+    }
+    EXPECT_GE(interval_num, kSoakTimeout / kSoakWindow);
+    std::filesystem::remove(hdr_path);
+  }
+
+  void
+  VerifyLatencyLog()
+  {
+    constexpr size_t kHeaderSize = 12;
+    constexpr size_t kRecSize = sizeof(::dbgroup::benchmark::component::LatencyRecord);
+    const auto &log_path = std::filesystem::temp_directory_path() / "cpp_bench_latency_test.bin";
+
+    Builder builder{target_, "Bench for testing", op_engine_};
+    builder.SetThreadNum(kThreadNum);
+    builder.SetRandomSeed(kRandomSeed);
+    builder.SetTimeOut(kShortTimeout);
+    builder.SetLatencyLog(log_path.string());
+
+    benchmarker_ = builder.Build();
+    benchmarker_->Run();
+    benchmarker_.reset();
+
+    const auto file_size = std::filesystem::file_size(log_path);
+    EXPECT_GT(file_size, kHeaderSize);
+    EXPECT_EQ((file_size - kHeaderSize) % kRecSize, 0);
+    std::filesystem::remove(log_path);
+  }
+
+  void
+  VerifyKeyBuckets()
+  {
+    Builder builder{target_, "Bench for testing", op_engine_};
+    builder.SetThreadNum(kThreadNum);
+    builder.SetRandomSeed(kRandomSeed);
+    builder.SetTimeOut(kShortTimeout);
+    builder.MeasureByKeyBucket(::dbgroup::example::kKeyBucketNum);
+
+    benchmarker_ = builder.Build();
+    benchmarker_->Run();
+  }
+
+  void
+  VerifyHeatmap()
+  {
+    constexpr size_t kWindowInMS = 100;
+    const auto &path = std::filesystem::temp_directory_path() / "cpp_bench_heatmap_test.csv";
+
+    Builder builder{target_, "Bench for testing", op_engine_};
+    builder.SetThreadNum(kThreadNum);
+    builder.SetRandomSeed(kRandomSeed);
+    builder.SetTimeOut(kShortTimeout);
+    builder.SetHeatmapLog(path.string(), kWindowInMS);
+
+    benchmarker_ = builder.Build();
+    benchmarker_->Run();
+
+    std::ifstream ifs{path};
+    size_t row_num = 0;
+    for (std::string line{}; std::getline(ifs, line);) {
+      ++row_num;
+    }
+    EXPECT_GE(row_num, kShortTimeout * 1000 / kWindowInMS);
+    std::filesystem::remove(path);
+  }
+
+  void
+  VerifySketchOutput()
+  {
+    const auto &path = std::filesystem::temp_directory_path() / "cpp_bench_sketch_test.bin";
+
+    Builder builder{target_, "Bench for testing", op_engine_};
+    builder.SetThreadNum(kThreadNum);
+    builder.SetRandomSeed(kRandomSeed);
+    builder.SetTimeOut(kShortTimeout);
+    builder.SetSketchOutput(path.string());
+
+    benchmarker_ = builder.Build();
+    benchmarker_->Run();
+
+    std::ifstream ifs{path, std::ios::binary};
+    const auto &sketch = component::SimpleDDSketch::Deserialize(ifs);
+    ASSERT_TRUE(sketch);
+    const auto &expected = benchmarker_->GetLatencySketch();
+    EXPECT_EQ(sketch->GetTotalExecNum(), expected.GetTotalExecNum());
+
+    std::ostringstream oss{};
+    EXPECT_TRUE(component::DistributionComparison::ReportFiles(oss, path.string(), path.string()));
+    EXPECT_FALSE(oss.str().empty());
+    std::filesystem::remove(path);
+  }
+
+  void
+  VerifyProgress()
+  {
+    constexpr size_t kIntervalInMS = 100;
+
+    Builder builder{target_, "Bench for testing", op_engine_};
+    builder.SetThreadNum(kThreadNum);
+    builder.SetRandomSeed(kRandomSeed);
+    builder.SetTimeOut(kShortTimeout);
+    builder.ReportProgress(kIntervalInMS);
+
+    benchmarker_ = builder.Build();
+    benchmarker_->Run();
+    EXPECT_GT(benchmarker_->GetLatencySketch().GetTotalExecNum(), 0);
+  }
+
+  void
+  VerifyStability()
+  {
+    constexpr size_t kWindowInMS = 100;
+
+    Builder builder{target_, "Bench for testing", op_engine_};
+    builder.SetThreadNum(kThreadNum);
+    builder.SetRandomSeed(kRandomSeed);
+    builder.SetTimeOut(kShortTimeout);
+    builder.MeasureStability(kWindowInMS);
+
+    benchmarker_ = builder.Build();
+    benchmarker_->Run();
+    EXPECT_GT(benchmarker_->GetLatencySketch().GetTotalExecNum(), 0);
+  }
+
+  void
+  VerifyFanOut()
+  {
+    constexpr size_t kFanOut = 4;
+
+    Builder builder{target_, "Bench for testing", op_engine_};
+    builder.SetThreadNum(kThreadNum);
+    builder.SetRandomSeed(kRandomSeed);
+    builder.SetTimeOut(kShortTimeout);
+    builder.SetFanOut(kFanOut, true);
+
+    benchmarker_ = builder.Build();
+    benchmarker_->Run();
+    EXPECT_GT(benchmarker_->GetLatencySketch().GetTotalExecNum(), 0);
+  }
+
+  void
+  VerifyStragglers(  //
+      const bool measure_stability)
+  {
+    constexpr size_t kWindowInMS = 100;
+    constexpr size_t kPeriodNano = 10000000;
+    constexpr size_t kStallNano = 1000000;
+
+    Builder builder{target_, "Bench for testing", op_engine_};
+    builder.SetThreadNum(kThreadNum);
+    builder.SetRandomSeed(kRandomSeed);
+    builder.SetTimeOut(kShortTimeout);
+    builder.SetStragglers(1, component::StallModel{component::StallModel::kSpin,
+                                                   component::StallModel::kBetweenOPs, kPeriodNano,
+                                                   kStallNano});
+    if (measure_stability) {
+      builder.MeasureStability(kWindowInMS);
+    }
+
+    benchmarker_ = builder.Build();
+    benchmarker_->Run();
+    EXPECT_GT(benchmarker_->GetLatencySketch().GetTotalExecNum(), 0);
+  }
+
+  void
+  VerifyInterruption()
+  {
+    Builder builder{target_, "Bench for testing", op_engine_};
+    builder.SetThreadNum(kThreadNum);
+    builder.SetRandomSeed(kRandomSeed);
+    builder.SetTimeOut(kLongTimeout);
+    benchmarker_ = builder.Build();
+
+    std::thread interrupter{[]() {
+      std::this_thread::sleep_for(std::chrono::milliseconds{kInterruptMilliSec});
+      std::raise(SIGINT);
+    }};
+    const auto &start = std::chrono::steady_clock::now();
+    benchmarker_->Run();
+    const auto &elapsed = std::chrono::steady_clock::now() - start;
+    interrupter.join();
+
+    EXPECT_LT(elapsed, std::chrono::seconds{kLongTimeout});
+  }
+
+  void
+  VerifySearchMaxThroughput(  //
+      const size_t thread_num)
+  {
+    Builder builder{target_, "Bench for testing", op_engine_};
+    builder.SetThreadNum(thread_num);
+    builder.SetRandomSeed(kRandomSeed);
+    builder.SetTimeOut(kShortTimeout);
+
+    benchmarker_ = builder.Build();
+    benchmarker_->SearchMaxThroughput({{0, kSLOQuantile, kSLOLatency}}, kSearchNum);
+  }
+
+  void
+  VerifySearchMaxThroughputWithInvalidSLO()
+  {
+    Builder builder{target_, "Bench for testing", op_engine_};
+    builder.SetRandomSeed(kRandomSeed);
+    builder.SetTimeOut(kShortTimeout);
+
+    benchmarker_ = builder.Build();
+    const auto start = std::chrono::steady_clock::now();
+    benchmarker_->SearchMaxThroughput(
+        {{OperationEngine::OPType::kTotalNum, kSLOQuantile, kSLOLatency}}, kSearchNum);
+    const auto &elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_LT(elapsed, std::chrono::seconds{kShortTimeout});
+  }
+
+  void
+  VerifyRunChurnTest(  //
+      const bool report_progress)
+  {
+    constexpr size_t kLifetimeInUs = 10000;
+    constexpr size_t kIntervalInMS = 100;
+
+    Builder builder{target_, "Bench for testing", op_engine_};
+    builder.SetThreadNum(kThreadNum);
+    builder.SetRandomSeed(kRandomSeed);
+    builder.SetTimeOut(kShortTimeout);
+    if (report_progress) {
+      builder.ReportProgress(kIntervalInMS);
+    }
+
+    benchmarker_ = builder.Build();
+    benchmarker_->RunChurnTest(kLifetimeInUs);
+  }
+
+  void
+  VerifyRunScalabilityTest(  //
+      const std::vector<size_t> &thread_nums,
+      const std::vector<size_t> &predicted_nums)
+  {
+    Builder builder{target_, "Bench for testing", op_engine_};
+    builder.SetRandomSeed(kRandomSeed);
+    builder.SetTimeOut(kShortTimeout);
+
+    benchmarker_ = builder.Build();
+    benchmarker_->RunScalabilityTest(thread_nums, predicted_nums);
+  }
+
  private:
   /*##########################################################################*
    * Internal member variables
@@ -119,4 +436,106 @@ TYPED_TEST(BenchmarkerFixture, RunBenchWithMultiWorkersSucceed)
   TestFixture::VerifyRunBench(TestFixture::kThreadNum);
 }
 
+TYPED_TEST(BenchmarkerFixture, RunBenchWithZeroWorkersKeepDefaultThreadNum)
+{  //
+  TestFixture::VerifyRunBench(0);
+}
+
+TYPED_TEST(BenchmarkerFixture, RunBenchWithEnvironmentCheckSucceed)
+{  //
+  TestFixture::VerifyCheckEnvironment();
+}
+
+TYPED_TEST(BenchmarkerFixture, RunBenchWithWarmUpDetectionSucceed)
+{  //
+  TestFixture::VerifyWarmUpDetection();
+}
+
+TYPED_TEST(BenchmarkerFixture, RunBenchWithSignalStopWorkersGracefully)
+{  //
+  TestFixture::VerifyInterruption();
+}
+
+TYPED_TEST(BenchmarkerFixture, SearchMaxThroughputWithMultiWorkersSucceed)
+{
+  TestFixture::VerifySearchMaxThroughput(TestFixture::kThreadNum);
+}
+
+TYPED_TEST(BenchmarkerFixture, SearchMaxThroughputWithInvalidSLOAbortIt)
+{  //
+  TestFixture::VerifySearchMaxThroughputWithInvalidSLO();
+}
+
+TYPED_TEST(BenchmarkerFixture, RunBenchWithKeyBucketsSucceed)
+{  //
+  TestFixture::VerifyKeyBuckets();
+}
+
+TYPED_TEST(BenchmarkerFixture, RunBenchWithHeatmapWriteWindows)
+{  //
+  TestFixture::VerifyHeatmap();
+}
+
+TYPED_TEST(BenchmarkerFixture, RunBenchWithSketchOutputWriteComparableSketch)
+{  //
+  TestFixture::VerifySketchOutput();
+}
+
+TYPED_TEST(BenchmarkerFixture, RunBenchWithProgressSucceed)
+{  //
+  TestFixture::VerifyProgress();
+}
+
+TYPED_TEST(BenchmarkerFixture, RunBenchWithStabilitySucceed)
+{  //
+  TestFixture::VerifyStability();
+}
+
+TYPED_TEST(BenchmarkerFixture, RunBenchWithFanOutSucceed)
+{  //
+  TestFixture::VerifyFanOut();
+}
+
+TYPED_TEST(BenchmarkerFixture, RunBenchWithStragglersSucceed)
+{  //
+  TestFixture::VerifyStragglers(false);
+}
+
+TYPED_TEST(BenchmarkerFixture, RunBenchWithStragglersAndStabilitySucceed)
+{  //
+  TestFixture::VerifyStragglers(true);
+}
+
+TYPED_TEST(BenchmarkerFixture, RunBenchWithLatencyLogWriteRecords)
+{  //
+  TestFixture::VerifyLatencyLog();
+}
+
+TYPED_TEST(BenchmarkerFixture, RunSoakTestWriteWindowsToLog)
+{  //
+  TestFixture::VerifyRunSoakTest();
+}
+
+TYPED_TEST(BenchmarkerFixture, RunChurnTestSucceed)
+{  //
+  TestFixture::VerifyRunChurnTest(false);
+}
+
+TYPED_TEST(BenchmarkerFixture, RunChurnTestWithProgressSucceed)
+{  //
+  TestFixture::VerifyRunChurnTest(true);
+}
+
+TYPED_TEST(BenchmarkerFixture, RunScalabilityTestSucceed)
+{  //
+  TestFixture::VerifyRunScalabilityTest({1, TestFixture::kThreadNum},
+                                        {2 * TestFixture::kThreadNum});
+}
+
+TYPED_TEST(BenchmarkerFixture, RunScalabilityTestWithZeroThreadsSkipThem)
+{  //
+  TestFixture::VerifyRunScalabilityTest({0, 1, TestFixture::kThreadNum},
+                                        {0, 2 * TestFixture::kThreadNum});
+}
+
 }  // namespace dbgroup::benchmark::test
@@ -0,0 +1,159 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dbgroup/benchmark/component/comparison.hpp"
+
+// C++ standard libraries
+#include <cstddef>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// external libraries
+#include "gtest/gtest.h"
+
+// local sources
+#include "dbgroup/benchmark/component/measurements.hpp"
+
+namespace dbgroup::benchmark::component::test
+{
+class DistributionComparisonFixture : public ::testing::Test
+{
+ protected:
+  /*##########################################################################*
+   * Constants
+   *##########################################################################*/
+
+  static constexpr size_t kOPsNum = 1;
+  static constexpr size_t kSampleNum = 100000;
+  static constexpr size_t kRandomSeed = 0;
+  static constexpr size_t kOffset = 1000;
+  static constexpr double kBinError = 0.03;
+
+  /*##########################################################################*
+   * Setup/Teardown
+   *##########################################################################*/
+
+  void
+  SetUp() override
+  {
+    std::mt19937_64 rand{kRandomSeed};
+    std::lognormal_distribution<double> dist{8.0, 0.5};
+    for (size_t i = 0; i < kSampleNum; ++i) {
+      samples_.emplace_back(static_cast<size_t>(dist(rand)));
+    }
+  }
+
+  void
+  TearDown() override
+  {
+  }
+
+  /*##########################################################################*
+   * Utility functions
+   *##########################################################################*/
+
+  template <class Func>
+  [[nodiscard]] auto
+  CreateSketch(  //
+      Func &&transform) const  //
+      -> SimpleDDSketch
+  {
+    SimpleDDSketch sketch{kOPsNum};
+    for (const auto lat : samples_) {
+      sketch.Add(0, 1, transform(lat));
+    }
+    return sketch;
+  }
+
+  /*##########################################################################*
+   * Internal member variables
+   *##########################################################################*/
+
+  std::vector<size_t> samples_{};
+};
+
+/*############################################################################*
+ * Unit test definitions
+ *############################################################################*/
+
+TEST_F(DistributionComparisonFixture, CompareSameDistributionsReturnZeroDistances)
+{
+  const auto &sketch = CreateSketch([](const size_t lat) { return lat; });
+  const DistributionComparison cmp{sketch, sketch, 0};
+
+  EXPECT_DOUBLE_EQ(cmp.GetKSDistance(), 0.0);
+  EXPECT_DOUBLE_EQ(cmp.GetWassersteinDistance(), 0.0);
+  ASSERT_FALSE(cmp.GetRatioCurve().empty());
+  for (const auto &point : cmp.GetRatioCurve()) {
+    EXPECT_DOUBLE_EQ(point.ratio, 1.0);
+  }
+}
+
+TEST_F(DistributionComparisonFixture, CompareShiftedDistributionsReturnOffset)
+{
+  const auto &base = CreateSketch([](const size_t lat) { return lat; });
+  const auto &target = CreateSketch([](const size_t lat) { return lat + kOffset; });
+  const DistributionComparison cmp{base, target, 0};
+
+  const auto mean = base.GetMean(0) + kOffset;
+  EXPECT_NEAR(cmp.GetWassersteinDistance(), kOffset, mean * kBinError);
+  EXPECT_GT(cmp.GetKSDistance(), 0.1);
+  EXPECT_LE(cmp.GetKSDistance(), 1.0);
+
+  // the shift affects lower percentiles more than higher ones
+  const auto &divergent = cmp.GetMostDivergentQuantiles(1);
+  ASSERT_EQ(divergent.size(), 1);
+  EXPECT_LT(divergent.front().q, 0.5);
+  EXPECT_GT(divergent.front().ratio, 1.0);
+}
+
+TEST_F(DistributionComparisonFixture, CompareScaledDistributionsReturnConstantRatios)
+{
+  const auto &base = CreateSketch([](const size_t lat) { return lat; });
+  const auto &target = CreateSketch([](const size_t lat) { return 2 * lat; });
+  const DistributionComparison cmp{base, target, 0};
+
+  for (const auto &point : cmp.GetRatioCurve()) {
+    EXPECT_NEAR(point.ratio, 2.0, 2.0 * kBinError);
+  }
+  EXPECT_NEAR(cmp.GetWassersteinDistance(), base.GetMean(0), base.GetMean(0) * kBinError);
+}
+
+TEST_F(DistributionComparisonFixture, CompareEmptySketchesReturnNothing)
+{
+  const auto &base = CreateSketch([](const size_t lat) { return lat; });
+  const DistributionComparison cmp{base, SimpleDDSketch{kOPsNum}, 0};
+
+  EXPECT_DOUBLE_EQ(cmp.GetKSDistance(), 0.0);
+  EXPECT_TRUE(cmp.GetRatioCurve().empty());
+}
+
+TEST_F(DistributionComparisonFixture, ReportOutputDivergentQuantiles)
+{
+  const auto &base = CreateSketch([](const size_t lat) { return lat; });
+  const auto &target = CreateSketch([](const size_t lat) { return lat + kOffset; });
+
+  std::ostringstream oss{};
+  DistributionComparison::Report(oss, base, target);
+  const auto &out = oss.str();
+  EXPECT_NE(out.find("OPS ID 0"), std::string::npos);
+  EXPECT_NE(out.find("KS distance"), std::string::npos);
+  EXPECT_NE(out.find("Wasserstein distance"), std::string::npos);
+}
+
+}  // namespace dbgroup::benchmark::component::test
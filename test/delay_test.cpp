@@ -0,0 +1,160 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dbgroup/benchmark/delay_injector.hpp"
+
+// C++ standard libraries
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <random>
+
+// external libraries
+#include "gtest/gtest.h"
+
+// library headers
+#include "dbgroup/benchmark/component/delay.hpp"
+#include "dbgroup/benchmark/component/stopwatch.hpp"
+#include "dbgroup/benchmark/component/straggler.hpp"
+#include "dbgroup/benchmark/component/worker.hpp"
+
+// local sources
+#include "operation_engine.hpp"
+#include "target.hpp"
+
+namespace dbgroup::benchmark::test
+{
+/*############################################################################*
+ * Global constants
+ *############################################################################*/
+
+constexpr size_t kSampleNum = 100000;
+constexpr size_t kDelayNano = 5000;
+constexpr size_t kRandomSeed = 0;
+
+/*############################################################################*
+ * Unit test definitions
+ *############################################################################*/
+
+TEST(DelayModelTest, SampleFollowConfiguredDistributions)
+{
+  std::mt19937_64 rand{kRandomSeed};
+  component::DelayModel model{};
+  model.delay_nano = kDelayNano;
+  EXPECT_EQ(model.Sample(rand), kDelayNano);
+
+  model.type = component::DelayModel::kUniform;
+  model.spread_nano = kDelayNano;
+  for (size_t i = 0; i < kSampleNum; ++i) {
+    const auto delay = model.Sample(rand);
+    EXPECT_GE(delay, kDelayNano);
+    EXPECT_LE(delay, 2 * kDelayNano);
+  }
+
+  model.type = component::DelayModel::kExponential;
+  double sum = 0;
+  for (size_t i = 0; i < kSampleNum; ++i) {
+    sum += static_cast<double>(model.Sample(rand));
+  }
+  EXPECT_NEAR(sum / kSampleNum, kDelayNano, kDelayNano * 0.05);  // NOLINT
+}
+
+TEST(DelayModelTest, SampleAddSpikesWithConfiguredProbability)
+{
+  constexpr double kSpikeProb = 0.01;
+  constexpr size_t kSpikeNano = 1000000;
+
+  std::mt19937_64 rand{kRandomSeed};
+  component::DelayModel model{};
+  model.spike_prob = kSpikeProb;
+  model.spike_nano = kSpikeNano;
+
+  size_t spike_num = 0;
+  for (size_t i = 0; i < kSampleNum; ++i) {
+    spike_num += (model.Sample(rand) == kSpikeNano) ? 1 : 0;
+  }
+  EXPECT_NEAR(static_cast<double>(spike_num) / kSampleNum, kSpikeProb, kSpikeProb * 0.2);
+}
+
+TEST(SpinDelayTest, WaitBusyWaitForGivenDuration)
+{
+  constexpr size_t kTrialNum = 11;
+
+  EXPECT_GT(component::SpinDelay::GetIterPerNano(), 0);
+  for (const size_t nano : {kDelayNano / 10, kDelayNano, kDelayNano * 10}) {
+    size_t min_elapsed = ~0UL;
+    for (size_t i = 0; i < kTrialNum; ++i) {
+      component::StopWatch stopwatch{};
+      stopwatch.Start();
+      component::SpinDelay::Wait(nano);
+      stopwatch.Stop();
+      min_elapsed = std::min(min_elapsed, stopwatch.GetNanoDuration());
+    }
+    EXPECT_GE(min_elapsed, nano * 8 / 10);   // NOLINT
+    EXPECT_LE(min_elapsed, nano * 15 / 10);  // NOLINT
+  }
+}
+
+TEST(StragglerTest, StallPointStallOnlyOnceAfterTrigger)
+{
+  constexpr size_t kStallNano = 1000000;
+  const component::StallModel model{component::StallModel::kSleep,
+                                    component::StallModel::kInCriticalSection, 1, kStallNano};
+
+  component::StopWatch stopwatch{};
+  stopwatch.Start();
+  component::Straggler::Trigger(model);
+  stopwatch.Stop();
+  EXPECT_LT(stopwatch.GetNanoDuration(), kStallNano);
+
+  stopwatch.Start();
+  component::Straggler::StallPoint();
+  stopwatch.Stop();
+  EXPECT_GE(stopwatch.GetNanoDuration(), kStallNano);
+
+  stopwatch.Start();
+  component::Straggler::StallPoint();
+  stopwatch.Stop();
+  EXPECT_LT(stopwatch.GetNanoDuration(), kStallNano);
+}
+
+TEST(DelayInjectorTest, ExecuteDelayWrappedTarget)
+{
+  using Target = example::Target<example::OptimisticLock>;
+  using Injector = DelayInjector<Target>;
+  using Worker = component::Worker<Injector, example::OperationEngine>;
+  constexpr auto kDuration = std::chrono::milliseconds{100};
+
+  Target target{};
+  component::DelayModel model{};
+  model.delay_nano = kDelayNano;
+  Injector injector{target, model, Injector::kAround};
+  example::OperationEngine engine{};
+  std::atomic_bool is_running{true};
+
+  Worker worker{injector, engine, is_running, 0, kRandomSeed};
+  const auto &now = std::chrono::high_resolution_clock::now();
+  worker.Measure(now, now + kDuration);
+
+  const auto &sketch = worker.MoveSketch();
+  for (size_t id = 0; id < example::OperationEngine::OPType::kTotalNum; ++id) {
+    if (!sketch.HasLatency(id)) continue;
+    EXPECT_GE(sketch.Quantile(id, 0.5), 2 * kDelayNano * 8 / 10);  // NOLINT
+  }
+}
+
+}  // namespace dbgroup::benchmark::test
@@ -29,6 +29,8 @@ namespace dbgroup::example
 
 constexpr size_t kPageNum = 1024;
 
+constexpr size_t kKeyBucketNum = 16;
+
 constexpr size_t kMaxExecNum = 1e7;
 
 constexpr size_t kCachelineSize = 64;
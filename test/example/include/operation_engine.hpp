@@ -178,6 +178,20 @@ class OperationEngine
   {
     return OPIter{rand_seed};
   }
+
+  /**
+   * @param pos The position of a target page.
+   * @return The ID of a key bucket that includes a given page.
+   * @note This function is optional and only used for per-key-bucket
+   * measurements.
+   */
+  [[nodiscard]] constexpr auto
+  GetKeyBucket(  //
+      const uint32_t pos) const  //
+      -> size_t
+  {
+    return pos * kKeyBucketNum / kPageNum;
+  }
 };
 
 }  // namespace dbgroup::example
@@ -0,0 +1,185 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dbgroup/benchmark/component/hdr_histogram.hpp"
+
+// C++ standard libraries
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// external libraries
+#include "gtest/gtest.h"
+
+// local sources
+#include "dbgroup/benchmark/component/measurements.hpp"
+
+namespace dbgroup::benchmark::component::test
+{
+class HdrHistogramFixture : public ::testing::Test
+{
+ protected:
+  /*##########################################################################*
+   * Constants
+   *##########################################################################*/
+
+  static constexpr size_t kOPsNum = 1;
+  static constexpr size_t kSampleNum = 100000;
+  static constexpr uint32_t kCompressedCookie = 0x1c849314;
+  static constexpr uint32_t kEncodingCookie = 0x1c849313;
+  static constexpr size_t kHeaderSize = 40;
+
+  /*##########################################################################*
+   * Setup/Teardown
+   *##########################################################################*/
+
+  void
+  SetUp() override
+  {
+  }
+
+  void
+  TearDown() override
+  {
+  }
+
+  /*##########################################################################*
+   * Utility functions
+   *##########################################################################*/
+
+  static auto
+  DecodeBase64(  //
+      const std::string &str)  //
+      -> std::vector<uint8_t>
+  {
+    const std::string kChars =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    std::vector<uint8_t> out{};
+    uint32_t word = 0;
+    size_t bits = 0;
+    for (const auto c : str) {
+      if (c == '=') break;
+      word = (word << 6U) | static_cast<uint32_t>(kChars.find(c));
+      bits += 6;
+      if (bits >= 8) {
+        bits -= 8;
+        out.emplace_back(static_cast<uint8_t>(word >> bits));
+      }
+    }
+    return out;
+  }
+
+  static auto
+  GetBigEndian(  //
+      const std::vector<uint8_t> &data,
+      const size_t pos,
+      const size_t len)  //
+      -> uint64_t
+  {
+    uint64_t val = 0;
+    for (size_t i = 0; i < len; ++i) {
+      val = (val << 8U) | data.at(pos + i);
+    }
+    return val;
+  }
+
+  static auto
+  InflateStored(  //
+      const std::vector<uint8_t> &zlib)  //
+      -> std::vector<uint8_t>
+  {
+    std::vector<uint8_t> out{};
+    size_t pos = 2;  // skip a zlib header
+    for (auto is_final = false; !is_final;) {
+      is_final = (zlib.at(pos) & 1U) != 0;
+      EXPECT_EQ(zlib.at(pos) >> 1U, 0);  // stored blocks
+      const auto len = zlib.at(pos + 1) | (zlib.at(pos + 2) << 8U);
+      const auto nlen = zlib.at(pos + 3) | (zlib.at(pos + 4) << 8U);
+      EXPECT_EQ(len ^ nlen, 0xFFFF);
+      out.insert(out.end(), zlib.begin() + pos + 5, zlib.begin() + pos + 5 + len);
+      pos += 5 + len;
+    }
+
+    uint32_t a = 1;
+    uint32_t b = 0;
+    for (const auto byte : out) {
+      a = (a + byte) % 65521;
+      b = (b + a) % 65521;
+    }
+    EXPECT_EQ(GetBigEndian(zlib, pos, 4), (b << 16U) | a);
+    return out;
+  }
+
+  /*##########################################################################*
+   * Functions for verification
+   *##########################################################################*/
+
+  void
+  VerifyEncoding(  //
+      const SimpleDDSketch &sketch)
+  {
+    const auto &compressed = DecodeBase64(EncodeHdrHistogram(sketch, 0));
+    ASSERT_EQ(GetBigEndian(compressed, 0, 4), kCompressedCookie);
+    ASSERT_EQ(GetBigEndian(compressed, 4, 4), compressed.size() - 8);
+
+    const auto &raw = InflateStored({compressed.begin() + 8, compressed.end()});
+    ASSERT_EQ(GetBigEndian(raw, 0, 4), kEncodingCookie);
+    ASSERT_EQ(GetBigEndian(raw, 4, 4), raw.size() - kHeaderSize);
+    EXPECT_GE(GetBigEndian(raw, 24, 8), sketch.Quantile(0, 1.0));
+
+    // decode ZigZag LEB128 counts and check the total
+    int64_t total = 0;
+    for (size_t pos = kHeaderSize; pos < raw.size();) {
+      uint64_t zz = 0;
+      for (size_t shift = 0;; shift += 7) {
+        const auto byte = raw.at(pos++);
+        zz |= static_cast<uint64_t>(byte & 0x7FU) << shift;
+        if ((byte & 0x80U) == 0) break;
+      }
+      const auto val = static_cast<int64_t>(zz >> 1U) ^ -static_cast<int64_t>(zz & 1U);
+      if (val > 0) {
+        total += val;
+      }
+    }
+    EXPECT_EQ(total, static_cast<int64_t>(sketch.GetExecNum(0)));
+  }
+};
+
+/*############################################################################*
+ * Unit test definitions
+ *############################################################################*/
+
+TEST_F(HdrHistogramFixture, EncodeHdrHistogramWithSingleValueKeepCount)
+{
+  SimpleDDSketch sketch{kOPsNum};
+  for (size_t i = 0; i < kSampleNum; ++i) {
+    sketch.Add(0, 1, 1000);
+  }
+  VerifyEncoding(sketch);
+}
+
+TEST_F(HdrHistogramFixture, EncodeHdrHistogramWithWideRangeKeepCount)
+{
+  SimpleDDSketch sketch{kOPsNum};
+  for (size_t i = 1; i <= kSampleNum; ++i) {
+    sketch.Add(0, 1, i * i);
+  }
+  VerifyEncoding(sketch);
+}
+
+}  // namespace dbgroup::benchmark::component::test
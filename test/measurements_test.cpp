@@ -0,0 +1,247 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dbgroup/benchmark/component/measurements.hpp"
+
+// C++ standard libraries
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <sstream>
+#include <vector>
+
+// external libraries
+#include "gtest/gtest.h"
+
+namespace dbgroup::benchmark::component::test
+{
+class SimpleDDSketchFixture : public ::testing::Test
+{
+ protected:
+  /*##########################################################################*
+   * Constants
+   *##########################################################################*/
+
+  static constexpr size_t kOPsNum = 1;
+  static constexpr size_t kSampleNum = 100000;
+  static constexpr size_t kSplitNum = 7;
+  static constexpr size_t kRandomSeed = 0;
+  static constexpr double kRelError = 1E-9;
+
+  /*##########################################################################*
+   * Setup/Teardown
+   *##########################################################################*/
+
+  void
+  SetUp() override
+  {
+    std::mt19937_64 rand{kRandomSeed};
+    std::lognormal_distribution<double> dist{8.0, 1.0};
+    for (size_t i = 0; i < kSampleNum; ++i) {
+      samples_.emplace_back(static_cast<size_t>(dist(rand)));
+    }
+  }
+
+  void
+  TearDown() override
+  {
+  }
+
+  /*##########################################################################*
+   * Functions for verification
+   *##########################################################################*/
+
+  void
+  VerifyMoments(  //
+      const SimpleDDSketch &sketch)
+  {
+    const auto n = static_cast<double>(samples_.size());
+    auto sum = 0.0;
+    for (const auto lat : samples_) {
+      sum += static_cast<double>(lat);
+    }
+    const auto mean = sum / n;
+    auto m2 = 0.0;
+    auto m3 = 0.0;
+    for (const auto lat : samples_) {
+      const auto d = static_cast<double>(lat) - mean;
+      m2 += d * d;
+      m3 += d * d * d;
+    }
+
+    EXPECT_EQ(sketch.GetTotalTime(0), static_cast<size_t>(sum));
+    EXPECT_NEAR(sketch.GetMean(0), mean, mean * kRelError);
+    EXPECT_NEAR(sketch.GetVariance(0), m2 / (n - 1), m2 / (n - 1) * kRelError);
+    const auto skew = std::sqrt(n) * m3 / std::pow(m2, 1.5);
+    EXPECT_NEAR(sketch.GetSkewness(0), skew, skew * kRelError);
+  }
+
+  /*##########################################################################*
+   * Internal member variables
+   *##########################################################################*/
+
+  std::vector<size_t> samples_{};
+};
+
+/*############################################################################*
+ * Unit test definitions
+ *############################################################################*/
+
+TEST_F(SimpleDDSketchFixture, GetBinPosReturnBinIncludingLatency)
+{
+  constexpr double kGamma = (1.0 + 0.01) / (1.0 - 0.01);
+  constexpr size_t kSmallMax = 1000000;
+  constexpr size_t kMinShift = 24;
+
+  const auto verify = [&](const size_t lat) {
+    const auto pos = SimpleDDSketch::GetBinPos(lat);
+    const auto val = static_cast<double>(lat);
+    if (lat > 1) {
+      ASSERT_LE(val, std::pow(kGamma, pos)) << lat;
+      ASSERT_GT(val, std::pow(kGamma, pos - 1)) << lat;
+    } else {
+      ASSERT_EQ(pos, 0);
+    }
+  };
+  for (size_t lat = 0; lat < kSmallMax; ++lat) {
+    verify(lat);
+  }
+  std::mt19937_64 rand{kRandomSeed};
+  for (size_t i = 0; i < kSampleNum; ++i) {
+    verify(rand() >> (kMinShift + rand() % kMinShift));  // up to 2^40 ns
+  }
+}
+
+TEST_F(SimpleDDSketchFixture, AddComputeExactMoments)
+{
+  SimpleDDSketch sketch{kOPsNum};
+  for (const auto lat : samples_) {
+    sketch.Add(0, 1, lat);
+  }
+  VerifyMoments(sketch);
+}
+
+TEST_F(SimpleDDSketchFixture, MergeComputeExactMoments)
+{
+  std::vector<SimpleDDSketch> sketches(kSplitNum, SimpleDDSketch{kOPsNum});
+  for (size_t i = 0; i < samples_.size(); ++i) {
+    sketches[(i * i) % kSplitNum].Add(0, 1, samples_[i]);  // uneven splits
+  }
+
+  SimpleDDSketch merged{kOPsNum};
+  for (const auto &sketch : sketches) {
+    merged += sketch;
+  }
+  VerifyMoments(merged);
+}
+
+TEST_F(SimpleDDSketchFixture, AddLongLatencyComputeStableMoments)
+{
+  constexpr size_t kBase = 1000000000000;  // about 17 minutes
+
+  SimpleDDSketch expected{kOPsNum};
+  std::vector<SimpleDDSketch> sketches(kSplitNum, SimpleDDSketch{kOPsNum});
+  for (size_t i = 0; i < samples_.size(); ++i) {
+    expected.Add(0, 1, samples_[i]);
+    sketches[(i * i) % kSplitNum].Add(0, 1, samples_[i] + kBase);
+  }
+  SimpleDDSketch shifted{kOPsNum};
+  for (const auto &sketch : sketches) {
+    shifted += sketch;
+  }
+
+  // central moments do not depend on the offset of latency
+  const auto mean = expected.GetMean(0);
+  const auto var = expected.GetVariance(0);
+  const auto skew = expected.GetSkewness(0);
+  EXPECT_NEAR(shifted.GetMean(0) - kBase, mean, mean * kRelError);
+  EXPECT_NEAR(shifted.GetVariance(0), var, var * kRelError);
+  EXPECT_NEAR(shifted.GetSkewness(0), skew, skew * kRelError);
+}
+
+TEST_F(SimpleDDSketchFixture, AddAndMergeOverflowingBinsKeepExactCounts)
+{
+  constexpr size_t kLat = 100;
+  constexpr size_t kDoublingNum = 16;  // exceed 32-bit counters
+
+  SimpleDDSketch sketch{kOPsNum};
+  for (size_t i = 0; i < kSampleNum; ++i) {
+    sketch.Add(0, 1, kLat);
+  }
+  const auto pos = SimpleDDSketch::GetBinPos(kLat);
+  ASSERT_EQ(sketch.GetBinCount(0, pos), kSampleNum);
+
+  auto expected = kSampleNum;
+  for (size_t i = 0; i < kDoublingNum; ++i) {
+    const auto copy = sketch;
+    sketch += copy;
+    expected *= 2;
+  }
+  EXPECT_EQ(sketch.GetBinCount(0, pos), expected);
+  EXPECT_EQ(sketch.GetExecNum(0), expected);
+  EXPECT_EQ(sketch.Quantile(0, 0.5), SimpleDDSketch::GetBinValue(pos));
+
+  std::stringstream ss{};
+  sketch.Serialize(ss);
+  const auto &restored = SimpleDDSketch::Deserialize(ss);
+  ASSERT_TRUE(restored);
+  EXPECT_EQ(restored->GetBinCount(0, pos), expected);
+}
+
+TEST_F(SimpleDDSketchFixture, DeserializeRestoreSerializedSketch)
+{
+  SimpleDDSketch sketch{kOPsNum};
+  for (const auto lat : samples_) {
+    sketch.Add(0, 1, lat);
+  }
+  std::stringstream ss{};
+  sketch.Serialize(ss);
+
+  const auto &restored = SimpleDDSketch::Deserialize(ss);
+  ASSERT_TRUE(restored);
+  VerifyMoments(*restored);
+  EXPECT_EQ(restored->GetTotalExecNum(), sketch.GetTotalExecNum());
+  for (size_t pos = 0; pos < SimpleDDSketch::kBinNum; ++pos) {
+    EXPECT_EQ(restored->GetBinCount(0, pos), sketch.GetBinCount(0, pos));
+  }
+  EXPECT_EQ(restored->Quantile(0, 0.0), sketch.Quantile(0, 0.0));
+  EXPECT_EQ(restored->Quantile(0, 1.0), sketch.Quantile(0, 1.0));
+}
+
+TEST_F(SimpleDDSketchFixture, DeserializeRejectBrokenInput)
+{
+  std::stringstream ss{"NOTASKETCH"};
+  EXPECT_FALSE(SimpleDDSketch::Deserialize(ss));
+}
+
+TEST_F(SimpleDDSketchFixture, DeserializeRejectHugeNumberOfOperations)
+{
+  constexpr size_t kMagicLen = 8;
+
+  SimpleDDSketch sketch{kOPsNum};
+  std::stringstream ss{};
+  sketch.Serialize(ss);
+
+  // overwrite the number of operations with a corrupted value
+  auto bytes = ss.str();
+  const auto ops_num = ~0UL;
+  bytes.replace(kMagicLen, sizeof(ops_num), reinterpret_cast<const char *>(&ops_num),  // NOLINT
+                sizeof(ops_num));
+  std::stringstream corrupted{bytes};
+  EXPECT_FALSE(SimpleDDSketch::Deserialize(corrupted));
+}
+
+}  // namespace dbgroup::benchmark::component::test
@@ -0,0 +1,111 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dbgroup/benchmark/component/metrics.hpp"
+
+// C++ standard libraries
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// external libraries
+#include "gtest/gtest.h"
+
+namespace dbgroup::benchmark::component::test
+{
+/*############################################################################*
+ * Global constants
+ *############################################################################*/
+
+constexpr size_t kThreadNum = 8;
+constexpr size_t kUpdateNum = 100000;
+
+/*############################################################################*
+ * Unit test definitions
+ *############################################################################*/
+
+TEST(MetricsTest, RegisterSameNameReturnSameID)
+{
+  const auto id = Metrics::RegisterCounter("test_counter");
+  EXPECT_EQ(Metrics::RegisterCounter("test_counter"), id);
+  EXPECT_NE(Metrics::RegisterCounter("another_counter"), id);
+  EXPECT_EQ(Metrics::GetCounterNames()[id], "test_counter");
+}
+
+TEST(MetricsTest, UpdateWithoutRegistryAreIgnored)
+{
+  const auto id = Metrics::RegisterCounter("ignored_counter");
+  Metrics::Increment(id);  // no registry is attached
+
+  MetricsRegistry registry{};
+  Metrics::Attach(&registry);
+  Metrics::Increment(id);
+  Metrics::Attach(nullptr);
+  Metrics::Increment(id);
+  EXPECT_EQ(registry.GetCounter(id), 1);
+}
+
+TEST(MetricsTest, MergeThreadLocalRegistriesSumAllUpdates)
+{
+  const auto cnt_id = Metrics::RegisterCounter("merged_counter");
+  const auto hist_id = Metrics::RegisterHistogram("merged_histogram");
+
+  std::vector<MetricsRegistry> registries(kThreadNum);
+  std::vector<std::thread> threads{};
+  for (size_t i = 0; i < kThreadNum; ++i) {
+    threads.emplace_back([&, i]() {
+      Metrics::Attach(&registries[i]);
+      for (size_t j = 1; j <= kUpdateNum; ++j) {
+        Metrics::Increment(cnt_id, 2);
+        Metrics::Record(hist_id, j);
+      }
+      Metrics::Attach(nullptr);
+    });
+  }
+  for (auto &&t : threads) {
+    t.join();
+  }
+
+  MetricsRegistry total{};
+  for (const auto &registry : registries) {
+    total += registry;
+  }
+  EXPECT_EQ(total.GetCounter(cnt_id), 2 * kThreadNum * kUpdateNum);
+  const auto &hists = total.GetHistograms();
+  EXPECT_EQ(hists.GetExecNum(hist_id), kThreadNum * kUpdateNum);
+  EXPECT_NEAR(hists.Quantile(hist_id, 0.5), kUpdateNum / 2, kUpdateNum * 0.02);  // NOLINT
+
+  std::ostringstream oss{};
+  total.Report(oss, true);
+  EXPECT_NE(oss.str().find("merged_counter," + std::to_string(2 * kThreadNum * kUpdateNum)),
+            std::string::npos);
+  EXPECT_NE(oss.str().find("merged_histogram,"), std::string::npos);
+}
+
+TEST(MetricsTest, MergeRegistryWithNewHistogramsExtendIt)
+{
+  MetricsRegistry total{};
+  const auto hist_id = Metrics::RegisterHistogram("late_histogram");
+  MetricsRegistry registry{};
+  registry.Record(hist_id, 1);
+
+  total += registry;
+  EXPECT_EQ(total.GetHistograms().GetExecNum(hist_id), 1);
+}
+
+}  // namespace dbgroup::benchmark::component::test
@@ -0,0 +1,293 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dbgroup/benchmark/component/worker.hpp"
+
+// C++ standard libraries
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+// external libraries
+#include "gtest/gtest.h"
+
+// library headers
+#include "dbgroup/benchmark/component/measurements.hpp"
+#include "dbgroup/benchmark/component/stopwatch.hpp"
+
+namespace dbgroup::benchmark::component::test
+{
+/*############################################################################*
+ * Empty target and operations for measuring overhead
+ *############################################################################*/
+
+/// @brief The number of operations for measuring overhead.
+constexpr size_t kOverheadExecNum = 1000000;
+
+/**
+ * @brief An operation engine that generates a fixed number of no-op operations.
+ *
+ */
+class NoOpEngine
+{
+ public:
+  enum OPType {
+    kNoOp = 0,
+    kTotalNum,
+  };
+
+  class OPIter
+  {
+   public:
+    [[nodiscard]] constexpr explicit
+    operator bool() const
+    {
+      return cnt_ < kOverheadExecNum;
+    }
+
+    [[nodiscard]] constexpr auto
+    operator*() const  //
+        -> std::pair<OPType, uint32_t>
+    {
+      return {kNoOp, static_cast<uint32_t>(cnt_)};
+    }
+
+    constexpr auto
+    operator++()  //
+        -> OPIter &
+    {
+      ++cnt_;
+      return *this;
+    }
+
+   private:
+    size_t cnt_{};
+  };
+
+  [[nodiscard]] constexpr auto
+  GetOPIter(  //
+      [[maybe_unused]] const size_t thread_id,
+      [[maybe_unused]] const size_t rand_seed) const  //
+      -> OPIter
+  {
+    return OPIter{};
+  }
+};
+
+/**
+ * @brief A target that does nothing.
+ *
+ */
+class NoOpTarget
+{
+ public:
+  constexpr void
+  SetUpForWorker() const
+  {
+  }
+
+  constexpr void
+  TearDownForWorker() const
+  {
+  }
+
+  [[nodiscard]] constexpr auto
+  Execute(  //
+      [[maybe_unused]] const NoOpEngine::OPType type,
+      [[maybe_unused]] const uint32_t pos) const  //
+      -> size_t
+  {
+    return 1;
+  }
+};
+
+/*############################################################################*
+ * Out-of-line recording path for comparison
+ *############################################################################*/
+
+/// @brief The number of latency samples for comparing recording paths.
+constexpr size_t kSampleNum = 200000;
+
+/// @brief The number of trials for comparing recording paths.
+constexpr size_t kTrialNum = 20;
+
+/**
+ * @brief A sketch that records latency by an out-of-line function.
+ *
+ * This class reproduces `SimpleDDSketch::Add` before it was inlined: it is not
+ * inlined into callers, computes bin positions by `std::log`, and updates
+ * central moments by Welford's method.
+ */
+class OutOfLineSketch
+{
+ public:
+  [[gnu::noinline]] void
+  Add(  //
+      const size_t cnt,
+      const size_t lat)
+  {
+    total_exec_num_ += cnt;
+    total_exec_time_nano_ += lat;
+    min_ = std::min(min_, lat);
+    max_ = std::max(max_, lat);
+
+    const auto pos = (lat == 0) ? 0 : static_cast<size_t>(std::ceil(std::log(lat) / denom_));
+    ++bins_[std::min(pos, SimpleDDSketch::kBinNum - 1)];
+    sum_ += lat;
+
+    const auto n = static_cast<double>(++exec_num_);
+    const auto delta = static_cast<double>(lat) - mean_;
+    const auto delta_n = delta / n;
+    const auto term = delta * delta_n * (n - 1.0);
+    mean_ += delta_n;
+    m3_ += term * delta_n * (n - 2.0) - 3.0 * delta_n * m2_;
+    m2_ += term;
+  }
+
+  [[nodiscard]] constexpr auto
+  GetTotalExecNum() const  //
+      -> size_t
+  {
+    return total_exec_num_;
+  }
+
+ private:
+  static constexpr double kAlpha = 0.01;
+
+  static inline const double denom_ = std::log((1.0 + kAlpha) / (1.0 - kAlpha));  // NOLINT
+
+  size_t total_exec_num_{};
+
+  size_t total_exec_time_nano_{};
+
+  size_t min_{~0UL};
+
+  size_t max_{};
+
+  size_t exec_num_{};
+
+  size_t sum_{};
+
+  double mean_{};
+
+  double m2_{};
+
+  double m3_{};
+
+  std::vector<uint32_t> bins_ = std::vector<uint32_t>(SimpleDDSketch::kBinNum);
+};
+
+/**
+ * @brief Measure the time for recording given samples into a sketch.
+ *
+ * @tparam Sketch A sketch class.
+ * @tparam Add A function type.
+ * @param empty An empty sketch to be copied.
+ * @param lats Latency samples.
+ * @param add A function for recording a sample into a sketch.
+ * @return The time per sample [ns].
+ */
+template <class Sketch, class Add>
+auto
+MeasureRecording(  //
+    const Sketch &empty,
+    const std::vector<size_t> &lats,
+    Add &&add)  //
+    -> double
+{
+  auto sketch = empty;
+  StopWatch stopwatch{};
+  stopwatch.Start();
+  for (const auto lat : lats) {
+    add(sketch, lat);
+  }
+  stopwatch.Stop();
+  EXPECT_EQ(sketch.GetTotalExecNum(), lats.size());
+  return static_cast<double>(stopwatch.GetNanoDuration()) / static_cast<double>(lats.size());
+}
+
+/*############################################################################*
+ * Unit test definitions
+ *############################################################################*/
+
+TEST(OverheadTest, MeasureNoOpTargetReportPerOperationOverhead)
+{
+  // allow much slower machines and sanitizer builds, but catch regressions that
+  // make the hot path orders of magnitude slower
+  constexpr double kMaxOverheadInNano = 2000.0;
+
+  NoOpTarget target{};
+  NoOpEngine engine{};
+  std::atomic_bool is_running{true};
+  Worker<NoOpTarget, NoOpEngine> worker{target, engine, is_running, 0, 0};
+
+  StopWatch stopwatch{};
+  stopwatch.Start();
+  worker.Measure();
+  stopwatch.Stop();
+
+  const auto &sketch = worker.MoveSketch();
+  ASSERT_EQ(sketch.GetExecNum(NoOpEngine::kNoOp), kOverheadExecNum);
+
+  const auto per_op = static_cast<double>(stopwatch.GetNanoDuration()) / kOverheadExecNum;
+  const auto timer = static_cast<double>(sketch.GetTotalExecTime()) / kOverheadExecNum;
+  RecordProperty("overhead_in_nano", std::to_string(per_op));
+  RecordProperty("recording_in_nano", std::to_string(per_op - timer));
+  EXPECT_LT(per_op, kMaxOverheadInNano);
+}
+
+TEST(OverheadTest, AddInlinedSketchFasterThanOutOfLineRecording)
+{
+  // the inlined path took about 65% of the time of the out-of-line one on the
+  // development VM, so this bound leaves a margin for noisy machines
+  constexpr double kMaxRatio = 0.8;
+
+  std::mt19937_64 rand{0};
+  std::lognormal_distribution<double> dist{7.0, 1.0};  // NOLINT
+  std::vector<size_t> lats(kSampleNum);
+  for (auto &&lat : lats) {
+    lat = static_cast<size_t>(dist(rand));
+  }
+
+  // interleave trials so that both paths see the same machine state, and use
+  // the best trial of each to filter out interference
+  const OutOfLineSketch out_of_line_empty{};
+  const SimpleDDSketch inlined_empty{1};
+  const auto &add_out_of_line = [](OutOfLineSketch &sketch, const size_t lat) {
+    sketch.Add(1, lat);
+  };
+  const auto &add_inlined = [](SimpleDDSketch &sketch, const size_t lat) {
+    sketch.Add(0, 1, lat);
+  };
+  auto out_of_line = std::numeric_limits<double>::max();
+  auto inlined = std::numeric_limits<double>::max();
+  for (size_t i = 0; i < kTrialNum; ++i) {
+    out_of_line = std::min(out_of_line, MeasureRecording(out_of_line_empty, lats, add_out_of_line));
+    inlined = std::min(inlined, MeasureRecording(inlined_empty, lats, add_inlined));
+  }
+  RecordProperty("out_of_line_add_in_nano", std::to_string(out_of_line));
+  RecordProperty("inlined_add_in_nano", std::to_string(inlined));
+  EXPECT_LT(inlined, out_of_line * kMaxRatio);
+}
+
+}  // namespace dbgroup::benchmark::component::test
@@ -0,0 +1,129 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dbgroup/benchmark/component/scalability.hpp"
+
+// C++ standard libraries
+#include <cstddef>
+#include <vector>
+
+// external libraries
+#include "gtest/gtest.h"
+
+namespace dbgroup::benchmark::component::test
+{
+class ScalabilityFixture : public ::testing::Test
+{
+ protected:
+  /*##########################################################################*
+   * Constants
+   *##########################################################################*/
+
+  static constexpr double kLambda = 1E6;
+  static constexpr double kSigma = 0.05;
+  static constexpr double kKappa = 0.001;
+  static constexpr double kRelError = 1E-6;
+
+  /*##########################################################################*
+   * Setup/Teardown
+   *##########################################################################*/
+
+  void
+  SetUp() override
+  {
+  }
+
+  void
+  TearDown() override
+  {
+  }
+
+  /*##########################################################################*
+   * Functions for verification
+   *##########################################################################*/
+
+  static auto
+  USL(  //
+      const size_t thread_num,
+      const double sigma,
+      const double kappa)  //
+      -> double
+  {
+    const auto n = static_cast<double>(thread_num);
+    return kLambda * n / (1.0 + sigma * (n - 1.0) + kappa * n * (n - 1.0));
+  }
+
+  void
+  VerifyFitting(  //
+      const ScalabilityModel::Type type,
+      const double sigma,
+      const double kappa)
+  {
+    std::vector<double> throughputs{};
+    for (const auto thread_num : thread_nums_) {
+      throughputs.emplace_back(USL(thread_num, sigma, kappa));
+    }
+
+    const ScalabilityModel model{type, thread_nums_, throughputs};
+    EXPECT_NEAR(model.GetLambda(), kLambda, kLambda * kRelError);
+    EXPECT_NEAR(model.GetContention(), sigma, kRelError);
+    EXPECT_NEAR(model.GetCoherency(), kappa, kRelError);
+
+    constexpr size_t kUnmeasuredNum = 48;
+    const auto expected = USL(kUnmeasuredNum, sigma, kappa);
+    EXPECT_NEAR(model.Predict(kUnmeasuredNum), expected, expected * kRelError);
+  }
+
+  /*##########################################################################*
+   * Internal member variables
+   *##########################################################################*/
+
+  std::vector<size_t> thread_nums_{1, 2, 4, 8, 16, 32};
+};
+
+/*############################################################################*
+ * Unit test definitions
+ *############################################################################*/
+
+TEST_F(ScalabilityFixture, FitUSLToUSLCurveRecoverCoefficients)
+{
+  VerifyFitting(ScalabilityModel::kUSL, kSigma, kKappa);
+}
+
+TEST_F(ScalabilityFixture, FitUSLToAmdahlCurveRecoverCoefficients)
+{
+  VerifyFitting(ScalabilityModel::kUSL, kSigma, 0.0);
+}
+
+TEST_F(ScalabilityFixture, FitAmdahlToAmdahlCurveRecoverCoefficients)
+{
+  VerifyFitting(ScalabilityModel::kAmdahl, kSigma, 0.0);
+}
+
+TEST_F(ScalabilityFixture, GetPeakThreadNumReturnPeakOfUSLCurve)
+{
+  std::vector<double> throughputs{};
+  for (const auto thread_num : thread_nums_) {
+    throughputs.emplace_back(USL(thread_num, kSigma, kKappa));
+  }
+  const ScalabilityModel model{ScalabilityModel::kUSL, thread_nums_, throughputs};
+
+  const auto peak = model.GetPeakThreadNum();
+  EXPECT_GE(model.Predict(peak), model.Predict(peak - 1));
+  EXPECT_GE(model.Predict(peak), model.Predict(peak + 1));
+}
+
+}  // namespace dbgroup::benchmark::component::test
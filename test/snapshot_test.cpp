@@ -0,0 +1,162 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dbgroup/benchmark/component/snapshot.hpp"
+
+// C++ standard libraries
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+// external libraries
+#include "gtest/gtest.h"
+
+// local sources
+#include "dbgroup/benchmark/component/measurements.hpp"
+
+namespace dbgroup::benchmark::component::test
+{
+class SnapshotFixture : public ::testing::Test
+{
+ protected:
+  /*##########################################################################*
+   * Constants
+   *##########################################################################*/
+
+  static constexpr size_t kOPsNum = 1;
+  static constexpr size_t kThreadNum = 4;
+  static constexpr size_t kCollectNum = 100;
+  static constexpr size_t kCheckMask = 63;
+  static constexpr size_t kMaxLatency = 1000;
+
+  /*##########################################################################*
+   * Setup/Teardown
+   *##########################################################################*/
+
+  void
+  SetUp() override
+  {
+    collector_.Start(kThreadNum, kOPsNum);
+  }
+
+  void
+  TearDown() override
+  {
+  }
+
+  /*##########################################################################*
+   * Utility functions
+   *##########################################################################*/
+
+  void
+  RecordLatency(  //
+      const size_t thread_id)
+  {
+    auto *live = collector_.GetSketch(thread_id);
+    auto *sketch = &live->GetActive();
+    size_t i = 1;
+    for (; is_running_.load(std::memory_order_relaxed); ++i) {
+      sketch->Add(0, 1, i % kMaxLatency + 1);
+      if ((i & kCheckMask) == 0 && live->IsRequested()) {
+        sketch = &live->Publish();
+      }
+    }
+    exec_nums_[thread_id] = i - 1;
+    finals_[thread_id] = live->Finish();
+  }
+
+  /*##########################################################################*
+   * Internal member variables
+   *##########################################################################*/
+
+  SnapshotCollector collector_{};
+
+  std::atomic_bool is_running_{true};
+
+  std::vector<size_t> exec_nums_ = std::vector<size_t>(kThreadNum);
+
+  std::vector<SimpleDDSketch> finals_ = std::vector<SimpleDDSketch>(kThreadNum);
+};
+
+/*############################################################################*
+ * Unit test definitions
+ *############################################################################*/
+
+TEST_F(SnapshotFixture, CollectWhileRecordingReturnConsistentSnapshots)
+{
+  std::vector<std::thread> threads{};
+  for (size_t i = 0; i < kThreadNum; ++i) {
+    threads.emplace_back([this, i]() { RecordLatency(i); });
+  }
+
+  size_t prev_num = 0;
+  for (size_t i = 0; i < kCollectNum; ++i) {
+    const auto &total = collector_.Collect();
+    const auto exec_num = total.GetExecNum(0);
+    size_t bin_sum = 0;
+    for (size_t pos = 0; pos < SimpleDDSketch::kBinNum; ++pos) {
+      bin_sum += total.GetBinCount(0, pos);
+    }
+    EXPECT_EQ(bin_sum, exec_num);
+    EXPECT_EQ(total.GetTotalExecNum(), exec_num);
+    EXPECT_GE(exec_num, prev_num);
+    prev_num = exec_num;
+  }
+
+  is_running_.store(false, std::memory_order_relaxed);
+  for (auto &&t : threads) {
+    t.join();
+  }
+  for (size_t i = 0; i < kThreadNum; ++i) {
+    EXPECT_EQ(finals_[i].GetExecNum(0), exec_nums_[i]);
+  }
+}
+
+TEST_F(SnapshotFixture, CollectAfterRestartIncludeLatencyBeforeRestart)
+{
+  constexpr size_t kFirstNum = 10;
+  constexpr size_t kSecondNum = 5;
+
+  SnapshotCollector collector{};
+  collector.Start(1, kOPsNum);
+  auto *live = collector.GetSketch(0);
+  std::atomic_bool is_restarted{false};
+  std::thread worker{[&]() {
+    for (size_t i = 0; i < kFirstNum; ++i) {
+      live->GetActive().Add(0, 1, i + 1);
+    }
+    const auto &first = live->Finish();
+    live->Restart(first);
+    for (size_t i = 0; i < kSecondNum; ++i) {
+      live->GetActive().Add(0, 1, i + 1);
+    }
+    is_restarted.store(true, std::memory_order_release);
+    while (!live->IsRequested()) {
+      // wait for a request from the reporter
+    }
+    live->Publish();
+    EXPECT_EQ(live->Finish().GetExecNum(0), kSecondNum);
+  }};
+
+  while (!is_restarted.load(std::memory_order_acquire)) {
+    // wait for the worker to restart
+  }
+  EXPECT_EQ(collector.Collect().GetExecNum(0), kFirstNum + kSecondNum);
+  worker.join();
+}
+
+}  // namespace dbgroup::benchmark::component::test
@@ -0,0 +1,85 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dbgroup/benchmark/component/stability.hpp"
+
+// C++ standard libraries
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+// external libraries
+#include "gtest/gtest.h"
+
+namespace dbgroup::benchmark::component::test
+{
+/*############################################################################*
+ * Global constants
+ *############################################################################*/
+
+constexpr double kThreshold = 0.9;
+constexpr double kEpsilon = 1E-9;
+
+/*############################################################################*
+ * Unit test definitions
+ *############################################################################*/
+
+TEST(ThroughputStabilityTest, ConstantThroughputHasNoVariation)
+{
+  const std::vector<double> throughputs(10, 1000.0);
+  const ThroughputStability stability{throughputs, kThreshold};
+
+  EXPECT_EQ(stability.GetWindowNum(), throughputs.size());
+  EXPECT_DOUBLE_EQ(stability.GetMean(), 1000.0);
+  EXPECT_NEAR(stability.GetCV(), 0.0, kEpsilon);
+  EXPECT_DOUBLE_EQ(stability.GetMin(), 1000.0);
+  EXPECT_DOUBLE_EQ(stability.GetMax(), 1000.0);
+  EXPECT_DOUBLE_EQ(stability.GetSlowFraction(), 0.0);
+}
+
+TEST(ThroughputStabilityTest, SlowWindowsAreCountedAgainstMedian)
+{
+  const std::vector<double> throughputs{100.0, 100.0, 100.0, 100.0, 80.0,
+                                        100.0, 50.0,  100.0, 100.0, 95.0};
+  const ThroughputStability stability{throughputs, kThreshold};
+
+  EXPECT_DOUBLE_EQ(stability.GetMedian(), 100.0);
+  EXPECT_DOUBLE_EQ(stability.GetMin(), 50.0);
+  EXPECT_DOUBLE_EQ(stability.GetMax(), 100.0);
+  EXPECT_DOUBLE_EQ(stability.GetSlowFraction(), 0.2);  // 80 and 50 are below 90
+}
+
+TEST(ThroughputStabilityTest, CVIsSampleStandardDeviationOverMean)
+{
+  const std::vector<double> throughputs{2.0, 4.0, 4.0, 4.0, 5.0, 5.0, 7.0, 9.0};
+  const ThroughputStability stability{throughputs, kThreshold};
+
+  // the sample variance is 32 / 7
+  EXPECT_DOUBLE_EQ(stability.GetMean(), 5.0);
+  EXPECT_NEAR(stability.GetCV(), std::sqrt(32.0 / 7.0) / 5.0, kEpsilon);
+  EXPECT_DOUBLE_EQ(stability.GetMedian(), 4.5);
+}
+
+TEST(ThroughputStabilityTest, EmptyWindowsYieldZeros)
+{
+  const ThroughputStability stability{{}, kThreshold};
+
+  EXPECT_EQ(stability.GetWindowNum(), 0);
+  EXPECT_DOUBLE_EQ(stability.GetCV(), 0.0);
+  EXPECT_DOUBLE_EQ(stability.GetSlowFraction(), 0.0);
+}
+
+}  // namespace dbgroup::benchmark::component::test
@@ -0,0 +1,119 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dbgroup/benchmark/component/steady_state.hpp"
+
+// C++ standard libraries
+#include <cstddef>
+#include <optional>
+#include <random>
+#include <vector>
+
+// external libraries
+#include "gtest/gtest.h"
+
+namespace dbgroup::benchmark::component::test
+{
+/*############################################################################*
+ * Global constants
+ *############################################################################*/
+
+constexpr size_t kSampleNum = 100;
+
+constexpr size_t kTransientNum = 20;
+
+constexpr double kSteadyValue = 1000.0;
+
+constexpr double kNoise = 10.0;
+
+constexpr size_t kRandomSeed = 0;
+
+/*############################################################################*
+ * Unit test definitions
+ *############################################################################*/
+
+TEST(SteadyStateTest, DetectSteadyStateWithTooShortSeriesReturnNothing)
+{
+  const std::vector<double> series(2 * kMSERBatchSize * kMSERMinBatchNum - 1, kSteadyValue);
+  EXPECT_FALSE(DetectSteadyState(series));
+}
+
+TEST(SteadyStateTest, DetectSteadyStateWithFlatSeriesTruncateNothing)
+{
+  std::mt19937_64 rand{kRandomSeed};
+  std::uniform_real_distribution<double> noise{-kNoise, kNoise};
+  std::vector<double> series{};
+  for (size_t i = 0; i < kSampleNum; ++i) {
+    series.emplace_back(kSteadyValue + noise(rand));
+  }
+
+  const auto &trunc = DetectSteadyState(series);
+  ASSERT_TRUE(trunc);
+  EXPECT_LT(*trunc, kTransientNum);
+}
+
+TEST(SteadyStateTest, DetectSteadyStateWithTransientTruncateIt)
+{
+  std::mt19937_64 rand{kRandomSeed};
+  std::uniform_real_distribution<double> noise{-kNoise, kNoise};
+  std::vector<double> series{};
+  for (size_t i = 0; i < kSampleNum; ++i) {
+    const auto ramp = (i < kTransientNum) ? static_cast<double>(i) / kTransientNum : 1.0;
+    series.emplace_back(kSteadyValue * ramp + noise(rand));
+  }
+
+  const auto &trunc = DetectSteadyState(series);
+  ASSERT_TRUE(trunc);
+  EXPECT_GE(*trunc, kTransientNum - kMSERBatchSize);
+  EXPECT_LE(*trunc, kTransientNum + kMSERBatchSize);
+}
+
+TEST(SteadyStateTest, DetectSteadyStateWithIncreasingSeriesReturnNothing)
+{
+  std::vector<double> series{};
+  for (size_t i = 0; i < kSampleNum; ++i) {
+    series.emplace_back(static_cast<double>(i * i));
+  }
+  EXPECT_FALSE(DetectSteadyState(series));
+}
+
+TEST(SteadyStateTest, DetectSteadyStateOnlineWithTransientNotTruncateTooEarly)
+{
+  std::mt19937_64 rand{kRandomSeed};
+  std::uniform_real_distribution<double> noise{-kNoise, kNoise};
+  std::vector<double> series{};
+  std::optional<size_t> trunc{};
+  for (size_t i = 0; i < kSampleNum && !trunc; ++i) {
+    const auto ramp = (i < kTransientNum) ? static_cast<double>(i) / kTransientNum : 1.0;
+    series.emplace_back(kSteadyValue * ramp + noise(rand));
+    trunc = DetectSteadyState(series);
+  }
+
+  ASSERT_TRUE(trunc);
+  EXPECT_GE(*trunc, kTransientNum - kMSERBatchSize);
+  EXPECT_GT(series.size(), 2 * *trunc);
+}
+
+TEST(SteadyStateTest, DetectSteadyStateOnlineWithIncreasingSeriesReturnNothing)
+{
+  std::vector<double> series{};
+  for (size_t i = 0; i < kSampleNum; ++i) {
+    series.emplace_back(static_cast<double>(i));
+    EXPECT_FALSE(DetectSteadyState(series));
+  }
+}
+
+}  // namespace dbgroup::benchmark::component::test
@@ -18,14 +18,24 @@
 
 // C++ standard libraries
 #include <atomic>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <mutex>
+#include <set>
 #include <shared_mutex>
+#include <span>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <variant>
 
 // external libraries
 #include "gtest/gtest.h"
 
 // library headers
+#include "dbgroup/benchmark/component/payload_pool.hpp"
 #include "dbgroup/benchmark/component/stopwatch.hpp"
 
 // local sources
@@ -34,6 +44,396 @@
 
 namespace dbgroup::benchmark::component::test
 {
+/*############################################################################*
+ * Variant operations for testing compile-time dispatch
+ *############################################################################*/
+
+/// @brief The number of operations in variant-mode tests.
+constexpr size_t kVariantExecNum = 10000;
+
+struct ReadOP {
+  uint32_t key{};
+};
+
+struct ScanOP {
+  uint32_t begin{};
+  uint32_t num{};
+};
+
+/**
+ * @brief An operation engine that yields operations as variants.
+ *
+ */
+class VariantEngine
+{
+ public:
+  enum OPType {
+    kRead = 0,
+    kScan,
+    kTotalNum,
+  };
+
+  using Operation = std::variant<ReadOP, ScanOP>;
+
+  class OPIter
+  {
+   public:
+    [[nodiscard]] constexpr explicit
+    operator bool() const
+    {
+      return cnt_ < kVariantExecNum;
+    }
+
+    [[nodiscard]] constexpr auto
+    operator*() const  //
+        -> Operation
+    {
+      const auto key = static_cast<uint32_t>(cnt_);
+      return (cnt_ % 3 == 0) ? Operation{ScanOP{key, 3}} : Operation{ReadOP{key}};
+    }
+
+    constexpr auto
+    operator++()  //
+        -> OPIter &
+    {
+      ++cnt_;
+      return *this;
+    }
+
+   private:
+    size_t cnt_{};
+  };
+
+  [[nodiscard]] constexpr auto
+  GetOPIter(  //
+      [[maybe_unused]] const size_t thread_id,
+      [[maybe_unused]] const size_t rand_seed) const  //
+      -> OPIter
+  {
+    return OPIter{};
+  }
+};
+
+/**
+ * @brief A target that provides `Execute` overloads for each operation.
+ *
+ */
+class VariantTarget
+{
+ public:
+  constexpr void
+  SetUpForWorker() const
+  {
+  }
+
+  constexpr void
+  TearDownForWorker() const
+  {
+  }
+
+  auto
+  Execute(  //
+      [[maybe_unused]] const ReadOP &op)  //
+      -> size_t
+  {
+    ++read_num_;
+    return 1;
+  }
+
+  auto
+  Execute(  //
+      const ScanOP &op)  //
+      -> size_t
+  {
+    ++scan_num_;
+    return op.num;
+  }
+
+  size_t read_num_{};
+
+  size_t scan_num_{};
+};
+
+TEST(VariantWorkerTest, MeasureVariantOPsDispatchToEachOverload)
+{
+  VariantTarget target{};
+  VariantEngine engine{};
+  std::atomic_bool is_running{true};
+  Worker<VariantTarget, VariantEngine> worker{target, engine, is_running, 0, 0};
+  worker.Measure();
+
+  const auto scan_num = (kVariantExecNum + 2) / 3;
+  EXPECT_EQ(target.scan_num_, scan_num);
+  EXPECT_EQ(target.read_num_, kVariantExecNum - scan_num);
+
+  const auto &sketch = worker.MoveSketch();
+  EXPECT_EQ(sketch.GetExecNum(VariantEngine::kScan), scan_num);
+  EXPECT_EQ(sketch.GetExecNum(VariantEngine::kRead), kVariantExecNum - scan_num);
+  EXPECT_EQ(sketch.GetTotalExecNum(), kVariantExecNum - scan_num + scan_num * 3);
+}
+
+/**
+ * @brief A target that records the number of scanned records as a metric.
+ *
+ */
+class MetricsTarget : public VariantTarget
+{
+ public:
+  using VariantTarget::Execute;
+
+  auto
+  Execute(  //
+      const ScanOP &op)  //
+      -> size_t
+  {
+    Metrics::Increment(scanned_id_, op.num);
+    return VariantTarget::Execute(op);
+  }
+
+  size_t scanned_id_{Metrics::RegisterCounter("scanned_records")};
+};
+
+TEST(VariantWorkerTest, MeasureWithMetricsCollectTargetDefinedCounters)
+{
+  MetricsTarget target{};
+  VariantEngine engine{};
+  std::atomic_bool is_running{true};
+  Worker<MetricsTarget, VariantEngine> worker{target, engine, is_running, 0, 0};
+  worker.Measure();
+
+  const auto &metrics = worker.MoveMetrics();
+  EXPECT_EQ(metrics.GetCounter(target.scanned_id_), target.scan_num_ * 3);
+}
+
+/**
+ * @brief A target whose setup and teardown hooks take a certain time.
+ *
+ */
+class LifecycleTarget : public VariantTarget
+{
+ public:
+  static constexpr auto kSetUpTime = std::chrono::milliseconds{1};
+
+  static constexpr auto kTearDownTime = std::chrono::milliseconds{2};
+
+  void
+  SetUpForWorker() const
+  {
+    std::this_thread::sleep_for(kSetUpTime);
+  }
+
+  void
+  TearDownForWorker()
+  {
+    ++teardown_num_;
+    std::this_thread::sleep_for(kTearDownTime);
+  }
+
+  size_t teardown_num_{};
+};
+
+TEST(VariantWorkerTest, TearDownMeasureExecutionTimeOfHooksOnce)
+{
+  LifecycleTarget target{};
+  VariantEngine engine{};
+  std::atomic_bool is_running{true};
+  {
+    Worker<LifecycleTarget, VariantEngine> worker{target, engine, is_running, 0, 0};
+    const std::chrono::nanoseconds setup_time{LifecycleTarget::kSetUpTime};
+    EXPECT_GE(worker.GetSetUpTime(), setup_time.count());
+    EXPECT_EQ(worker.GetTearDownTime(), 0);
+
+    worker.Measure();
+    worker.TearDown();
+    const std::chrono::nanoseconds teardown_time{LifecycleTarget::kTearDownTime};
+    EXPECT_GE(worker.GetTearDownTime(), teardown_time.count());
+  }
+  EXPECT_EQ(target.teardown_num_, 1);
+}
+
+/**
+ * @brief A target that records worker IDs given to its setup hook.
+ *
+ */
+class WorkerIDTarget : public VariantTarget
+{
+ public:
+  void
+  SetUpForWorker(  //
+      const size_t worker_id)
+  {
+    const std::lock_guard guard{mtx_};
+    worker_ids_.insert(worker_id);
+  }
+
+  std::mutex mtx_{};
+
+  std::set<size_t> worker_ids_{};
+};
+
+TEST(VariantWorkerTest, SetUpWithFanOutHelpersGiveUniqueWorkerIDs)
+{
+  constexpr size_t kThreadID = 2;
+  constexpr size_t kFanOut = 3;
+
+  WorkerIDTarget target{};
+  VariantEngine engine{};
+  std::atomic_bool is_running{true};
+  Worker<WorkerIDTarget, VariantEngine> worker{
+      target, engine, is_running, kThreadID, 0, 0, 0, kFanOut, true};
+  worker.TearDown();
+
+  const std::set<size_t> expected{kThreadID * kFanOut, kThreadID * kFanOut + 1,
+                                  kThreadID * kFanOut + 2};
+  EXPECT_EQ(target.worker_ids_, expected);
+}
+
+/*############################################################################*
+ * Tuple arguments for testing argument forwarding
+ *############################################################################*/
+
+/// @brief The number of bytes in a payload pool.
+constexpr size_t kPoolSize = 4096;
+
+/// @brief The length of each payload.
+constexpr size_t kPayloadLen = 100;
+
+/**
+ * @brief An operation engine that yields multiple arguments as a tuple.
+ *
+ */
+class TupleEngine
+{
+ public:
+  enum OPType {
+    kWrite = 0,
+    kScan,
+    kTotalNum,
+  };
+
+  using Args = std::tuple<uint32_t, std::span<const std::byte>, uint32_t>;
+
+  class OPIter
+  {
+   public:
+    explicit OPIter(  //
+        const PayloadPool &pool)
+        : pool_{&pool}
+    {
+    }
+
+    [[nodiscard]] constexpr explicit
+    operator bool() const
+    {
+      return cnt_ < kVariantExecNum;
+    }
+
+    [[nodiscard]] auto
+    operator*() const  //
+        -> std::pair<OPType, Args>
+    {
+      const auto key = static_cast<uint32_t>(cnt_);
+      const auto type = (cnt_ % 2 == 0) ? kWrite : kScan;
+      return {type, Args{key, pool_->Get(cnt_ * 7, kPayloadLen), key % 10}};
+    }
+
+    constexpr auto
+    operator++()  //
+        -> OPIter &
+    {
+      ++cnt_;
+      return *this;
+    }
+
+   private:
+    const PayloadPool *pool_{};
+
+    size_t cnt_{};
+  };
+
+  [[nodiscard]] auto
+  GetOPIter(  //
+      [[maybe_unused]] const size_t thread_id,
+      [[maybe_unused]] const size_t rand_seed) const  //
+      -> OPIter
+  {
+    return OPIter{pool_};
+  }
+
+  PayloadPool pool_{kPoolSize};
+};
+
+/**
+ * @brief A target that receives unpacked arguments.
+ *
+ */
+class TupleTarget
+{
+ public:
+  explicit TupleTarget(  //
+      const PayloadPool &pool)
+      : pool_{pool}
+  {
+  }
+
+  constexpr void
+  SetUpForWorker() const
+  {
+  }
+
+  constexpr void
+  TearDownForWorker() const
+  {
+  }
+
+  auto
+  Execute(  //
+      const TupleEngine::OPType type,
+      [[maybe_unused]] const uint32_t key,
+      const std::span<const std::byte> value,
+      const uint32_t scan_len)  //
+      -> size_t
+  {
+    const auto *begin = pool_.Get(0, pool_.GetSize()).data();
+    in_pool_ &= value.size() == kPayloadLen && value.data() >= begin
+                && value.data() + value.size() <= begin + pool_.GetSize();
+    return (type == TupleEngine::kScan) ? scan_len : 1;
+  }
+
+  const PayloadPool &pool_;
+
+  bool in_pool_{true};
+};
+
+TEST(TupleWorkerTest, MeasureTupleArgsForwardThemWithoutCopies)
+{
+  TupleEngine engine{};
+  TupleTarget target{engine.pool_};
+  std::atomic_bool is_running{true};
+  Worker<TupleTarget, TupleEngine> worker{target, engine, is_running, 0, 0};
+  worker.Measure();
+
+  EXPECT_TRUE(target.in_pool_);
+  const auto &sketch = worker.MoveSketch();
+  EXPECT_EQ(sketch.GetExecNum(TupleEngine::kWrite), kVariantExecNum / 2);
+  EXPECT_EQ(sketch.GetExecNum(TupleEngine::kScan), kVariantExecNum / 2);
+}
+
+TEST(TupleWorkerTest, GetTooLongPayloadTruncateItToPool)
+{
+  const PayloadPool pool{kPoolSize};
+  const auto *begin = pool.Get(0, kPoolSize).data();
+  for (size_t pos = 0; pos < kPayloadLen; ++pos) {
+    const auto &payload = pool.Get(pos, kPoolSize + kPayloadLen);
+    EXPECT_EQ(payload.data(), begin);
+    EXPECT_EQ(payload.size(), kPoolSize);
+  }
+}
+
+/*############################################################################*
+ * Fixture class definition
+ *############################################################################*/
+
 template <class Competitor>
 class WorkerFixture : public ::testing::Test
 {
@@ -88,6 +488,102 @@ class WorkerFixture : public ::testing::Test
     }
   }
 
+  void
+  VerifyFanOut(  //
+      const bool use_helpers)
+  {
+    constexpr size_t kFanOut = 4;
+    constexpr auto kDuration = std::chrono::milliseconds{200};
+
+    worker_ = std::make_unique<TestWorker>(target_, op_engine_, is_running_, 0, kRandomSeed, 0, 0,
+                                           kFanOut, use_helpers);
+    const auto &now = std::chrono::high_resolution_clock::now();
+    worker_->Measure(now, now + kDuration);
+
+    const auto &logical = worker_->MoveSketch();
+    const auto &sub_ops = worker_->MoveSubOPSketch();
+    EXPECT_GT(logical.GetTotalExecNum(), 0);
+    EXPECT_EQ(sub_ops.GetTotalExecNum(), logical.GetTotalExecNum() * kFanOut);
+
+    // the maximum of sub-operations cannot be faster than a sub-operation
+    for (size_t id = 0; id < OperationEngine::OPType::kTotalNum; ++id) {
+      if (!logical.HasLatency(id) || !sub_ops.HasLatency(id)) continue;
+      EXPECT_GE(logical.Quantile(id, 0.5), sub_ops.Quantile(id, 0.5));  // NOLINT
+    }
+  }
+
+  void
+  VerifyOverloadedOpenLoop()
+  {
+    constexpr auto kDuration = std::chrono::milliseconds{100};
+    constexpr size_t kIntervalNano = 1;
+
+    // operations arrive much faster than they finish, so a backlog grows
+    worker_ = std::make_unique<TestWorker>(target_, op_engine_, is_running_, 0, kRandomSeed,
+                                           kIntervalNano);
+    const auto &now = std::chrono::high_resolution_clock::now();
+    worker_->Measure(now, now + kDuration);
+
+    const std::chrono::nanoseconds window{worker_->GetMeasuredWindow()};
+    EXPECT_GE(window, kDuration);
+    EXPECT_LT(window, 2 * kDuration);
+  }
+
+  void
+  VerifyRecorder()
+  {
+    constexpr auto kDuration = std::chrono::milliseconds{200};
+    constexpr size_t kWindowNano = 50000000;
+
+    SoakRecorder recorder{1, OperationEngine::OPType::kTotalNum, kWindowNano, ""};
+    worker_ = std::make_unique<TestWorker>(target_, op_engine_, is_running_, 0, kRandomSeed);
+    const auto &now = std::chrono::high_resolution_clock::now();
+    worker_->Measure(now, now + kDuration, &recorder);
+    recorder.Finish(worker_->GetMeasuredWindow());
+
+    // the worker keeps its whole latency in addition to submitted windows
+    const auto &sketch = worker_->MoveSketch();
+    EXPECT_GT(sketch.GetTotalExecNum(), 0);
+    EXPECT_EQ(sketch.GetTotalExecNum(), recorder.GetTotalSketch().GetTotalExecNum());
+  }
+
+  void
+  VerifyStall(  //
+      const StallModel::Type type)
+  {
+    constexpr auto kDuration = std::chrono::milliseconds{200};
+    constexpr size_t kPeriodNano = 10000000;
+    constexpr size_t kStallNano = 1000000;
+
+    const StallModel model{type, StallModel::kBetweenOPs, kPeriodNano, kStallNano};
+    worker_ = std::make_unique<TestWorker>(target_, op_engine_, is_running_, 0, kRandomSeed, 0, 0,
+                                           1, false, &model);
+    const auto &now = std::chrono::high_resolution_clock::now();
+    worker_->Measure(now, now + kDuration);
+
+    // each period includes a stall, so stalls are fewer than `kDuration / kPeriodNano`
+    const auto max_num = kDuration / std::chrono::nanoseconds{kPeriodNano};
+    EXPECT_GT(worker_->GetStallNum(), max_num / 2);
+    EXPECT_LE(worker_->GetStallNum(), max_num);
+  }
+
+  void
+  VerifyStallWithoutStallPoint()
+  {
+    constexpr auto kDuration = std::chrono::milliseconds{50};
+    constexpr size_t kPeriodNano = 10000000;
+    constexpr size_t kStallNano = 1000000;
+
+    // the target never reaches a stall point, so armed stalls are not executed
+    const StallModel model{StallModel::kSpin, StallModel::kInCriticalSection, kPeriodNano,
+                           kStallNano};
+    worker_ = std::make_unique<TestWorker>(target_, op_engine_, is_running_, 0, kRandomSeed, 0, 0,
+                                           1, false, &model);
+    const auto &now = std::chrono::high_resolution_clock::now();
+    worker_->Measure(now, now + kDuration);
+    EXPECT_EQ(worker_->GetStallNum(), 0);
+  }
+
  private:
   /*##########################################################################*
    * Internal constants
@@ -130,4 +626,39 @@ TYPED_TEST(WorkerFixture, MeasureWithSampleIncrementorMeasureReasonableResults)
   TestFixture::VerifyMeasure();
 }
 
+TYPED_TEST(WorkerFixture, MeasureWithSerialFanOutRecordMaxOfSubOPs)
+{
+  TestFixture::VerifyFanOut(false);
+}
+
+TYPED_TEST(WorkerFixture, MeasureWithParallelFanOutRecordMaxOfSubOPs)
+{
+  TestFixture::VerifyFanOut(true);
+}
+
+TYPED_TEST(WorkerFixture, MeasureAsSpinningStragglerStallPeriodically)
+{
+  TestFixture::VerifyStall(StallModel::kSpin);
+}
+
+TYPED_TEST(WorkerFixture, MeasureAsSleepingStragglerStallPeriodically)
+{
+  TestFixture::VerifyStall(StallModel::kSleep);
+}
+
+TYPED_TEST(WorkerFixture, MeasureAsStragglerWithoutStallPointExecuteNoStalls)
+{
+  TestFixture::VerifyStallWithoutStallPoint();
+}
+
+TYPED_TEST(WorkerFixture, MeasureOverloadedOpenLoopStopAtDeadline)
+{
+  TestFixture::VerifyOverloadedOpenLoop();
+}
+
+TYPED_TEST(WorkerFixture, MeasureWithRecorderKeepWholeLatency)
+{
+  TestFixture::VerifyRecorder();
+}
+
 }  // namespace dbgroup::benchmark::component::test